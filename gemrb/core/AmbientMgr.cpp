@@ -58,11 +58,12 @@ void AmbientMgr::Reset()
 	AmbientsSet(ambients);
 }
 
-void AmbientMgr::UpdateVolume(unsigned short volume)
+void AmbientMgr::UpdateVolume(unsigned short value)
 {
 	std::lock_guard<std::recursive_mutex> l(mutex);
+	volume = value;
 	for (const auto& source : ambientSources) {
-		source->SetVolume(volume);
+		source->SetVolume(value);
 	}
 }
 
@@ -131,6 +132,7 @@ void AmbientMgr::Activate(StringView name)
 			break;
 		}
 	}
+	WakeAll();
 	cond.notify_all();
 }
 
@@ -138,6 +140,7 @@ void AmbientMgr::Activate()
 {
 	std::lock_guard<std::recursive_mutex> l(mutex);
 	active = true;
+	WakeAll();
 	cond.notify_all();
 }
 
@@ -151,6 +154,7 @@ void AmbientMgr::Deactivate(StringView name)
 			break;
 		}
 	}
+	WakeAll();
 	cond.notify_all();
 }
 
@@ -179,6 +183,14 @@ void AmbientMgr::HardStop() const
 	}
 }
 
+// makes every source check its state again on the next tick
+void AmbientMgr::WakeAll() const
+{
+	for (auto source : ambientSources) {
+		source->due = 0;
+	}
+}
+
 int AmbientMgr::Play()
 {
 	while (playing) {
@@ -208,8 +220,24 @@ tick_t AmbientMgr::Tick(tick_t ticks) const
 	}
 
 	std::lock_guard<std::recursive_mutex> l(mutex);
+	// sources disabled for this part of the day may be enabled in the next
+	if (timeslice != lastTimeslice) {
+		lastTimeslice = timeslice;
+		WakeAll();
+	}
+
 	for (auto source : ambientSources) {
-		tick_t newdelay = source->Tick(ticks, listener, timeslice);
+		tick_t newdelay;
+		if (source->due > ticks) {
+			newdelay = source->due - ticks;
+		} else {
+			newdelay = source->Tick(ticks, listener, timeslice, volume);
+			if (newdelay == std::numeric_limits<tick_t>::max()) {
+				source->due = newdelay;
+			} else {
+				source->due = ticks + newdelay;
+			}
+		}
 		if (newdelay < delay) delay = newdelay;
 	}
 	return delay;
@@ -225,7 +253,7 @@ AmbientMgr::AmbientSource::~AmbientSource()
 	}
 }
 
-tick_t AmbientMgr::AmbientSource::Tick(tick_t ticks, Point listener, ieDword timeslice)
+tick_t AmbientMgr::AmbientSource::Tick(tick_t ticks, Point listener, ieDword timeslice, unsigned short volume)
 {
 	// if we are out of sounds do nothing
 	if (ambient->sounds.empty()) {
@@ -281,8 +309,7 @@ tick_t AmbientMgr::AmbientSource::Tick(tick_t ticks, Point listener, ieDword tim
 	unsigned int channel = ambient->GetFlags() & IE_AMBI_LOOPING ? (ambient->GetFlags() & IE_AMBI_MAIN ? SFX_CHAN_AREA_AMB : SFX_CHAN_AMB_LOOP) : SFX_CHAN_AMB_OTHER;
 	totalgain = ambient->GetTotalGain() * core->GetAudioDrv()->GetVolume(channel) / 100;
 
-	unsigned int v = 100;
-	core->GetDictionary()->Lookup("Volume Ambients", v);
+	unsigned int v = volume;
 
 	if (stream < 0) {
 		// we need to allocate a stream
@@ -59,6 +59,8 @@ private:
 	mutable std::mutex ambientsMutex;
 	std::vector<Ambient *> ambients;
 	std::atomic_bool active {false};
+	// "Volume Ambients", pushed from the main thread by UpdateVolume
+	std::atomic<unsigned short> volume {100};
 
 	mutable std::recursive_mutex mutex;
 	std::thread player;
@@ -71,10 +73,13 @@ private:
 		AmbientSource(const AmbientSource&) = delete;
 		~AmbientSource();
 		AmbientSource& operator=(const AmbientSource&) = delete;
-		tick_t Tick(tick_t ticks, Point listener, ieDword timeslice);
+		tick_t Tick(tick_t ticks, Point listener, ieDword timeslice, unsigned short volume);
 		void HardStop();
 		void SetVolume(unsigned short volume) const;
 		const Ambient* GetAmbient() const { return ambient; };
+
+		// when Tick needs to run next, so idle sources aren't even looked at
+		tick_t due = 0;
 	private:
 		int stream = -1;
 		const Ambient* ambient;
@@ -88,9 +93,13 @@ private:
 	};
 	std::vector<AmbientSource*> ambientSources;
 
+	// the schedule slot the sources were last checked against
+	mutable ieDword lastTimeslice = 0;
+
 	int Play();
 	tick_t Tick(tick_t ticks) const;
 	void HardStop() const;
+	void WakeAll() const;
 };
 
 }
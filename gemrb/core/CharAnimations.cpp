@@ -670,6 +670,7 @@ CharAnimations::CharAnimations(unsigned int AnimID, ieDword ArmourLevel)
 void CharAnimations::DropAnims()
 {
 	Anims.fill({});
+	prefetched = false;
 }
 
 CharAnimations::~CharAnimations(void)
@@ -840,6 +841,76 @@ WSW 003      |      013 ESE
 
 */
 
+// NewResRef is based on the prefix ResRef and various suffixes
+// equipment parts return an empty ResRef if there is nothing to draw
+ResRef CharAnimations::GetPartResRef(unsigned char StanceID, orient_t Orient, int part,
+					 unsigned char& Cycle, EquipResRefData& equipment) const
+{
+	ResRef NewResRef;
+	int actorPartCount = GetActorPartCount();
+	if (part < actorPartCount) {
+		// Character animation parts
+
+		equipment = EquipResRefData();
+
+		//we need this long for special anims
+		NewResRef = ResRefBase;
+		GetAnimResRef(StanceID, Orient, NewResRef, Cycle, part, equipment);
+		return NewResRef;
+	}
+
+	// Equipment animation parts
+	if (GetSize() == 0) return NewResRef;
+
+	if (part == actorPartCount) {
+		if (WeaponRef[0] == 0) return NewResRef;
+		// weapon
+		GetEquipmentResRef(WeaponRef, false, NewResRef, Cycle, equipment);
+	} else if (part == actorPartCount+1) {
+		if (OffhandRef[0] == 0) return NewResRef;
+		if (WeaponType == IE_ANI_WEAPON_2H) return NewResRef;
+		// off-hand
+		if (WeaponType == IE_ANI_WEAPON_1H) {
+			GetEquipmentResRef(OffhandRef, false, NewResRef, Cycle, equipment);
+		} else { // IE_ANI_WEAPON_2W
+			GetEquipmentResRef(OffhandRef, true, NewResRef, Cycle, equipment);
+		}
+	} else if (part == actorPartCount+2) {
+		if (HelmetRef[0] == 0) return NewResRef;
+		// helmet
+		GetEquipmentResRef(HelmetRef, false, NewResRef, Cycle, equipment);
+	}
+	return NewResRef;
+}
+
+// queue the files of the stances that usually follow (combat and death), so
+// gamedata can load them over the next frames instead of stalling the first
+// attack or death of this creature type
+void CharAnimations::PrefetchStances(orient_t Orient) const
+{
+	static const unsigned char likelyStances[] = {
+		IE_ANI_READY, IE_ANI_ATTACK, IE_ANI_ATTACK_SLASH, IE_ANI_ATTACK_BACKSLASH,
+		IE_ANI_ATTACK_JAB, IE_ANI_SHOOT, IE_ANI_DAMAGE, IE_ANI_DIE
+	};
+
+	int AnimType = GetAnimType();
+	// pst stance remapping is done ad hoc in GetAnimation
+	if (AnimType == -1 || AnimType >= IE_ANI_PST_ANIMATION_1) return;
+
+	int partCount = GetTotalPartCount();
+	for (unsigned char stance : likelyStances) {
+		stance = MaybeOverrideStance(stance);
+		if (!Anims[stance][Orient].empty()) continue;
+
+		EquipResRefData equipment;
+		for (int part = 0; part < partCount; ++part) {
+			unsigned char Cycle = 0;
+			ResRef NewResRef = GetPartResRef(stance, Orient, part, Cycle, equipment);
+			gamedata->PrefetchFactoryResource(NewResRef, IE_BAM_CLASS_ID);
+		}
+	}
+}
+
 const CharAnimations::PartAnim* CharAnimations::GetAnimation(unsigned char Stance, orient_t Orient)
 {
 	if (Stance >= MAX_ANIMS) {
@@ -951,44 +1022,18 @@ const CharAnimations::PartAnim* CharAnimations::GetAnimation(unsigned char Stanc
 	
 	PartAnim newparts(partCount);
 
+	if (!prefetched) {
+		// the first time we're seen, so get the likely followups ready
+		PrefetchStances(Orient);
+		prefetched = true;
+	}
+
 	EquipResRefData equipment;
 	for (int part = 0; part < partCount; ++part)
 	{
-		// NewResRef is based on the prefix ResRef and various suffixes
-		ResRef NewResRef;
 		unsigned char Cycle = 0;
-		if (part < actorPartCount) {
-			// Character animation parts
-
-			equipment = EquipResRefData();
-
-			//we need this long for special anims
-			NewResRef = ResRefBase;
-			GetAnimResRef(stanceID, Orient, NewResRef, Cycle, part, equipment);
-		} else {
-			// Equipment animation parts
-
-			if (GetSize() == 0) continue;
-
-			if (part == actorPartCount) {
-				if (WeaponRef[0] == 0) continue;
-				// weapon
-				GetEquipmentResRef(WeaponRef, false, NewResRef, Cycle, equipment);
-			} else if (part == actorPartCount+1) {
-				if (OffhandRef[0] == 0) continue;
-				if (WeaponType == IE_ANI_WEAPON_2H) continue;
-				// off-hand
-				if (WeaponType == IE_ANI_WEAPON_1H) {
-					GetEquipmentResRef(OffhandRef, false, NewResRef, Cycle, equipment);
-				} else { // IE_ANI_WEAPON_2W
-					GetEquipmentResRef(OffhandRef, true, NewResRef, Cycle, equipment);
-				}
-			} else if (part == actorPartCount+2) {
-				if (HelmetRef[0] == 0) continue;
-				// helmet
-				GetEquipmentResRef(HelmetRef, false, NewResRef, Cycle, equipment);
-			}
-		}
+		ResRef NewResRef = GetPartResRef(stanceID, Orient, part, Cycle, equipment);
+		if (part >= actorPartCount && NewResRef.IsEmpty()) continue;
 
 		const AnimationFactory* af = static_cast<const AnimationFactory*>(
 			gamedata->GetFactoryResource(NewResRef, IE_BAM_CLASS_ID));
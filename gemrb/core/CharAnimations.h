@@ -282,6 +282,9 @@ private:
 		ResRef& dest, unsigned char& Cycle, int Part, EquipResRefData& equip) const;
 	void GetEquipmentResRef(AnimRef equipRef, bool offhand,
 		ResRef& dest, unsigned char& Cycle, const EquipResRefData& equip) const;
+	ResRef GetPartResRef(unsigned char StanceID, orient_t Orient, int part,
+		unsigned char& Cycle, EquipResRefData& equipment) const;
+	void PrefetchStances(orient_t Orient) const;
 	unsigned char MaybeOverrideStance(unsigned char stance) const;
 	void MaybeUpdateMainPalette(const Animation&);
 	
@@ -303,6 +306,7 @@ private:
 	
 	StanceAnim Anims;
 	StanceAnim shadowAnimations;
+	bool prefetched = false;
 
 	AnimRef HelmetRef;
 	AnimRef WeaponRef;
@@ -21,7 +21,6 @@
 
 #include "strrefs.h"
 
-#include "DialogMgr.h"
 #include "DisplayMessage.h"
 #include "Game.h"
 #include "GameData.h"
@@ -55,11 +54,6 @@ DialogHandler::DialogHandler(void)
 	}
 }
 
-DialogHandler::~DialogHandler(void)
-{
-	delete dlg;
-}
-
 void DialogHandler::UpdateJournalForTransition(const DialogTransition* tr) const
 {
 	if (!tr || !(tr->Flags&IE_DLG_TR_JOURNAL)) return;
@@ -97,24 +91,19 @@ void DialogHandler::UpdateJournalForTransition(const DialogTransition* tr) const
 //Try to start dialogue between two actors (one of them could be inanimate)
 bool DialogHandler::InitDialog(Scriptable* spk, Scriptable* tgt, const ResRef& dialogRef, ieDword si)
 {
-	delete dlg;
 	dlg = nullptr;
 
 	if (dialogRef.IsEmpty() || IsStar(dialogRef)) {
 		return false;
 	}
 
-	PluginHolder<DialogMgr> dm = GetImporter<DialogMgr>(IE_DLG_CLASS_ID);
-	dm->Open(gamedata->GetResource(dialogRef, IE_DLG_CLASS_ID));
-	dlg = dm->GetDialog();
+	dlg = gamedata->GetDialog(dialogRef);
 
 	if (!dlg) {
 		Log(ERROR, "DialogHandler", "Cannot start dialog ({}): {} with {}", dialogRef, fmt::WideToChar{spk->GetName()}, fmt::WideToChar{tgt->GetName()});
 		return false;
 	}
 
-	dlg->resRef = dialogRef; //this isn't handled by GetDialog???
-
 	//target is here because it could be changed when a dialog runs onto
 	//and external link, we need to find the new target (whose dialog was
 	//linked to)
@@ -209,7 +198,6 @@ void DialogHandler::EndDialog(bool try_to_break)
 		target->SetCircleSize();
 	}
 	ds = nullptr;
-	delete dlg;
 	dlg = nullptr;
 
 	core->ToggleViewsEnabled(true, "NOT_DLG");
@@ -353,19 +341,21 @@ bool DialogHandler::DialogChoose(unsigned int choose)
 			}
 
 			// do not interrupt during dialog actions (needed for aerie.d polymorph block)
-			target->AddAction( GenerateAction( "SetInterrupt(FALSE)" ) );
+			target->AddAction(MakeAction(ActionID::SetInterrupt).Int(0));
 			// delay all other actions until the next cycle (needed for the machine of Lum the Mad (gorlum2.dlg))
 			// FIXME: figure out if pst needs something similar (action missing)
 			//        (not conditional on GenerateAction to prevent console spam)
 			// iwd2 41nate.d breaks if this is included, since the original delayed execution in a different manner
 			if (!core->HasFeature(GF_AREA_OVERRIDE) && !core->HasFeature(GF_3ED_RULES) && !(tr->Flags & IE_DLG_IMMEDIATE)) {
-				target->AddAction(GenerateAction("BreakInstants()"));
+				target->AddAction(MakeAction(ActionID::BreakInstants));
 			}
+			// the compiled dialog is shared, so queue copies the actions can scribble on
 			for (unsigned int i = 0; i < tr->actions.size(); i++) {
-				if (i == tr->actions.size() - 1) tr->actions[i]->flags |= ACF_REALLOW_SCRIPTS;
-				target->AddAction(tr->actions[i]);
+				Action* action = ParamCopy(tr->actions[i]);
+				if (i == tr->actions.size() - 1) action->flags |= ACF_REALLOW_SCRIPTS;
+				target->AddAction(action);
 			}
-			target->AddAction( GenerateAction( "SetInterrupt(TRUE)" ) );
+			target->AddAction(MakeAction(ActionID::SetInterrupt).Int(1));
 		}
 
 		if (tr->Flags & IE_DLG_TR_FINAL) {
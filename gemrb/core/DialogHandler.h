@@ -26,6 +26,8 @@
 #include "Dialog.h"
 #include "Scriptable/Scriptable.h"
 
+#include <memory>
+
 namespace GemRB {
 
 class Control;
@@ -34,7 +36,6 @@ class GEM_EXPORT DialogHandler {
 public:
 	DialogHandler();
 	DialogHandler(const DialogHandler&) = delete;
-	~DialogHandler();
 	DialogHandler& operator=(const DialogHandler&) = delete;
 
 	Scriptable *GetTarget() const;
@@ -55,7 +56,7 @@ private:
 	void UpdateJournalForTransition(const DialogTransition* tr) const;
 
 	DialogState* ds = nullptr;
-	Dialog* dlg = nullptr;
+	std::shared_ptr<Dialog> dlg;
 
 	ieDword speakerID = 0;
 	ieDword targetID = 0;
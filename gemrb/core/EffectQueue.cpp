@@ -36,6 +36,7 @@
 #include "Spell.h" //needs for the source flags bitfield
 #include "TableMgr.h"
 
+#include <algorithm>
 #include <cstdio>
 #include "GameData.h"
 
@@ -85,6 +86,8 @@ struct Globals {
 	
 	int pstflags = false;
 	bool iwd2fx = false;
+	// ProtectionKind bits per opcode
+	std::vector<ieDword> protectionBits;
 	
 	static const Globals& Get() {
 		static Globals globs;
@@ -142,7 +145,12 @@ private:
 			}
 		}
 		core->DelSymbol( eT );
+
+		// the opcodes are known now, so the protection refs resolve for good
+		InitProtectionBits();
 	}
+
+	void InitProtectionBits();
 	
 	// nonstatic, this actually depends on Globals() indirectly
 	void ResolveEffectRefImp(EffectRef &effect_reference) const
@@ -200,6 +208,69 @@ static EffectRef fx_spelltrap = { "SpellTrap", -1 };
 //weapon immunity
 static EffectRef fx_weapon_immunity_ref = { "Protection:Weapons", -1 };
 
+// the kinds of protection check_type looks for, one bit each
+enum ProtectionKind : ieDword {
+	PROT_LEVEL = 1 << 0,
+	PROT_SPELL = 1 << 1,
+	PROT_SPELL2 = 1 << 2,
+	PROT_SCHOOL = 1 << 3,
+	PROT_SECTYPE = 1 << 4,
+	PROT_LEVEL_DEC = 1 << 5,
+	PROT_SPELL_DEC = 1 << 6,
+	PROT_SCHOOL_DEC = 1 << 7,
+	PROT_SECTYPE_DEC = 1 << 8,
+	PROT_SPELLTRAP = 1 << 9,
+	BOUNCE_LEVEL = 1 << 10,
+	BOUNCE_PROJECTILE = 1 << 11,
+	BOUNCE_SPELL = 1 << 12,
+	BOUNCE_SCHOOL = 1 << 13,
+	BOUNCE_SECTYPE = 1 << 14,
+	BOUNCE_LEVEL_DEC = 1 << 15,
+	BOUNCE_SPELL_DEC = 1 << 16,
+	BOUNCE_SCHOOL_DEC = 1 << 17,
+	BOUNCE_SECTYPE_DEC = 1 << 18
+};
+
+void Globals::InitProtectionBits()
+{
+	const std::pair<EffectRef*, ieDword> kinds[] = {
+		{ &fx_level_immunity_ref, PROT_LEVEL },
+		{ &fx_spell_immunity_ref, PROT_SPELL },
+		{ &fx_spell_immunity2_ref, PROT_SPELL2 },
+		{ &fx_school_immunity_ref, PROT_SCHOOL },
+		{ &fx_secondary_type_immunity_ref, PROT_SECTYPE },
+		{ &fx_level_immunity_dec_ref, PROT_LEVEL_DEC },
+		{ &fx_spell_immunity_dec_ref, PROT_SPELL_DEC },
+		{ &fx_school_immunity_dec_ref, PROT_SCHOOL_DEC },
+		{ &fx_secondary_type_immunity_dec_ref, PROT_SECTYPE_DEC },
+		{ &fx_spelltrap, PROT_SPELLTRAP },
+		{ &fx_level_bounce_ref, BOUNCE_LEVEL },
+		{ &fx_projectile_bounce_ref, BOUNCE_PROJECTILE },
+		{ &fx_spell_bounce_ref, BOUNCE_SPELL },
+		{ &fx_school_bounce_ref, BOUNCE_SCHOOL },
+		{ &fx_secondary_type_bounce_ref, BOUNCE_SECTYPE },
+		{ &fx_level_bounce_dec_ref, BOUNCE_LEVEL_DEC },
+		{ &fx_spell_bounce_dec_ref, BOUNCE_SPELL_DEC },
+		{ &fx_school_bounce_dec_ref, BOUNCE_SCHOOL_DEC },
+		{ &fx_secondary_type_bounce_dec_ref, BOUNCE_SECTYPE_DEC }
+	};
+
+	protectionBits.assign(MAX_EFFECTS, 0);
+	for (const auto& kind : kinds) {
+		// called from the constructor, so not through Get()
+		ResolveEffectRefImp(*kind.first);
+		if (kind.first->opcode >= 0) {
+			protectionBits[kind.first->opcode] |= kind.second;
+		}
+	}
+}
+
+static ieDword ProtectionBits(ieDword opcode)
+{
+	const auto& bits = Globals::Get().protectionBits;
+	return opcode < bits.size() ? bits[opcode] : 0;
+}
+
 bool EffectQueue::match_ids(const Actor *target, int table, ieDword value)
 {
 	if( value == 0) {
@@ -363,7 +434,7 @@ void EffectQueue::ModifyEffectPoint(EffectRef &effect_reference, ieDword x, ieDw
 
 void EffectQueue::ModifyAllEffectSources(const Point &source)
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		fx.Source = source;
 	}
 }
@@ -421,23 +492,69 @@ Effect *EffectQueue::CreateUnsummonEffect(const Effect *fx)
 	return newfx;
 }
 
+EffectQueue::EffectQueue(const EffectQueue& other)
+: slotCount(other.slotCount), freeSlots(other.freeSlots), order(other.order),
+opcodeIndex(other.opcodeIndex), indexStale(other.indexStale), protections(other.protections),
+Owner(other.Owner)
+{
+	chunks.reserve(other.chunks.size());
+	for (slot_t chunk = 0; chunk < other.chunks.size(); ++chunk) {
+		slot_t capacity = ChunkCapacity(chunk);
+		chunks.emplace_back(new Effect[capacity]);
+		std::copy(&other.chunks[chunk][0], &other.chunks[chunk][0] + capacity, &chunks[chunk][0]);
+	}
+}
+
+EffectQueue& EffectQueue::operator=(const EffectQueue& other)
+{
+	if (this != &other) {
+		*this = EffectQueue(other);
+	}
+	return *this;
+}
+
 void EffectQueue::AddEffect(Effect* fx, bool insert)
 {
-	if (insert) {
-		effects.push_front(std::move(*fx));
+	slot_t slot;
+	if (!freeSlots.empty()) {
+		slot = freeSlots.back();
+		freeSlots.pop_back();
 	} else {
-		effects.push_back(std::move(*fx));
+		slot = slotCount++;
+		slot_t offset;
+		slot_t chunk = ChunkOf(slot, offset);
+		if (chunk == chunks.size()) {
+			chunks.emplace_back(new Effect[ChunkCapacity(chunk)]);
+		}
 	}
+	Slot(slot) = std::move(*fx);
 	delete fx;
+
+	if (insert) {
+		order.insert(order.begin(), slot);
+		frontInserts++;
+	} else {
+		order.push_back(slot);
+	}
+
+	if (indexStale) return;
+	protections |= ProtectionBits(Slot(slot).Opcode);
+	slots_t& bucket = OpcodeBucket(Slot(slot).Opcode);
+	if (insert) {
+		bucket.insert(bucket.begin(), slot);
+	} else {
+		bucket.push_back(slot);
+	}
 }
 
 //This method can remove an effect described by a pointer to it, or
 //an exact matching effect
+//the effect is only marked as expired, Cleanup will drop it
 bool EffectQueue::RemoveEffect(const Effect* fx)
 {
-	for (auto f = effects.begin(); f != effects.end(); ++f) {
-		if (*fx == *f) {
-			effects.erase(f);
+	for (auto& f : OpcodeEffects(fx->Opcode)) {
+		if (*fx == f) {
+			f.TimingMode = FX_DURATION_JUST_EXPIRED;
 			return true;
 		}
 	}
@@ -451,25 +568,67 @@ void EffectQueue::ApplyAllEffects(Actor* target)
 {
 	const auto& Opcodes = Globals::Get().Opcodes;
 
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
+		ieDword opcode = fx.Opcode;
 		if (Opcodes[fx.Opcode].Flags & EFFECT_REINIT_ON_LOAD) {
 			// pretend to be the first application (FirstApply==1)
 			ApplyEffect(target, &fx, 1);
 		} else {
 			ApplyEffect(target, &fx, 0);
 		}
+		// some effects turn into another opcode when applied (eg. item creation into removal)
+		if (fx.Opcode != opcode) {
+			indexStale = true;
+		}
 	}
 }
 
 void EffectQueue::Cleanup()
 {
-	for (auto f = effects.begin(); f != effects.end(); ) {
-		if (f->TimingMode == FX_DURATION_JUST_EXPIRED) {
-			f = effects.erase(f);
+	auto live = order.begin();
+	for (slot_t slot : order) {
+		if (Slot(slot).TimingMode == FX_DURATION_JUST_EXPIRED) {
+			freeSlots.push_back(slot);
 		} else {
-			++f;
+			*live++ = slot;
 		}
 	}
+	if (live == order.end()) return;
+
+	order.erase(live, order.end());
+	indexStale = true;
+}
+
+EffectQueue::slots_t& EffectQueue::OpcodeBucket(ieDword opcode) const
+{
+	return opcodeIndex[opcode];
+}
+
+void EffectQueue::RefreshIndex() const
+{
+	// only empty the buckets, running iterations may still point at them
+	for (auto& bucket : opcodeIndex) {
+		bucket.second.clear();
+	}
+	protections = 0;
+	for (slot_t slot : order) {
+		ieDword opcode = Slot(slot).Opcode;
+		OpcodeBucket(opcode).push_back(slot);
+		protections |= ProtectionBits(opcode);
+	}
+	indexStale = false;
+}
+
+const EffectQueue::slots_t& EffectQueue::OpcodeSlots(ieDword opcode) const
+{
+	static const slots_t none;
+
+	if (indexStale) {
+		RefreshIndex();
+	}
+
+	auto bucket = opcodeIndex.find(opcode);
+	return bucket == opcodeIndex.end() ? none : bucket->second;
 }
 
 //Handle the target flag when the effect is applied first
@@ -705,7 +864,7 @@ int EffectQueue::AddAllEffects(Actor* target, const Point &destination)
 	if( target) {
 		target->RollSaves();
 	}
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		//handle resistances and saving throws here
 		fx.random_value = random_value;
 		//if applyeffect returns true, we stop adding the future effects
@@ -805,11 +964,17 @@ static int check_type(Actor *actor, const Effect& fx)
 	//the protective effect (if any)
 	Effect *efx;
 
+	// most targets have none of these, so only look up the effects that are there
+	ieDword protections = actor->fxqueue.Protections();
+	if (!protections) {
+		return 1;
+	}
+
 	ieDword bounce = actor->GetStat(IE_BOUNCE);
 
 	//spell level immunity
 	// but ignore it if we're casting beneficial stuff on ourselves
-	if (fx.Power && actor->fxqueue.HasEffectWithParamPair(fx_level_immunity_ref, fx.Power, 0)) {
+	if (fx.Power && (protections & PROT_LEVEL) && actor->fxqueue.HasEffectWithParamPair(fx_level_immunity_ref, fx.Power, 0)) {
 		const Actor *caster = core->GetGame()->GetActorByGlobalID(fx.CasterID);
 		if (caster != actor || (fx.SourceFlags & SF_HOSTILE)) {
 			Log(DEBUG, "EffectQueue", "Resisted by level immunity");
@@ -820,11 +985,11 @@ static int check_type(Actor *actor, const Effect& fx)
 	//source immunity (spell name)
 	//if source is unspecified, don't resist it
 	if (!fx.SourceRef.IsEmpty()) {
-		if (actor->fxqueue.HasEffectWithResource(fx_spell_immunity_ref, fx.SourceRef)) {
+		if ((protections & PROT_SPELL) && actor->fxqueue.HasEffectWithResource(fx_spell_immunity_ref, fx.SourceRef)) {
 			Log(DEBUG, "EffectQueue", "Resisted by spell immunity ({})", fx.SourceRef);
 			return 0;
 		}
-		if (actor->fxqueue.HasEffectWithResource(fx_spell_immunity2_ref, fx.SourceRef)) {
+		if ((protections & PROT_SPELL2) && actor->fxqueue.HasEffectWithResource(fx_spell_immunity2_ref, fx.SourceRef)) {
 			if (fx.SourceRef != "detect") { // our secret door pervasive effect
 				Log(DEBUG, "EffectQueue", "Resisted by spell immunity2 ({})", fx.SourceRef);
 			}
@@ -833,7 +998,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	}
 
 	//primary type immunity (school)
-	if (fx.PrimaryType) {
+	if (fx.PrimaryType && (protections & PROT_SCHOOL)) {
 		if (actor->fxqueue.HasEffectWithParam(fx_school_immunity_ref, fx.PrimaryType)) {
 			Log(DEBUG, "EffectQueue", "Resisted by school/primary type");
 			return 0;
@@ -841,7 +1006,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	}
 
 	//secondary type immunity (usage)
-	if (fx.SecondaryType) {
+	if (fx.SecondaryType && (protections & PROT_SECTYPE)) {
 		if (actor->fxqueue.HasEffectWithParam(fx_secondary_type_immunity_ref, fx.SecondaryType)) {
 			Log(DEBUG, "EffectQueue", "Resisted by usage/secondary type");
 			return 0;
@@ -850,7 +1015,7 @@ static int check_type(Actor *actor, const Effect& fx)
 
 	//decrementing immunity checks
 	//decrementing level immunity
-	if (fx.Power && fx.Resistance != FX_NO_RESIST_BYPASS_BOUNCE) {
+	if (fx.Power && (protections & PROT_LEVEL_DEC) && fx.Resistance != FX_NO_RESIST_BYPASS_BOUNCE) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParam(fx_level_immunity_dec_ref, fx.Power));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Resisted by level immunity (decrementing)");
@@ -859,7 +1024,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	}
 
 	//decrementing spell immunity
-	if (!fx.SourceRef.IsEmpty()) {
+	if (!fx.SourceRef.IsEmpty() && (protections & PROT_SPELL_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithResource(fx_spell_immunity_dec_ref, fx.SourceRef));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Resisted by spell immunity (decrementing)");
@@ -867,7 +1032,7 @@ static int check_type(Actor *actor, const Effect& fx)
 		}
 	}
 	//decrementing primary type immunity (school)
-	if (fx.PrimaryType) {
+	if (fx.PrimaryType && (protections & PROT_SCHOOL_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParam(fx_school_immunity_dec_ref, fx.PrimaryType));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Resisted by school immunity (decrementing)");
@@ -876,7 +1041,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	}
 
 	//decrementing secondary type immunity (usage)
-	if (fx.SecondaryType) {
+	if (fx.SecondaryType && (protections & PROT_SECTYPE_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParam(fx_secondary_type_immunity_dec_ref, fx.SecondaryType));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Resisted by usage/sectype immunity (decrementing)");
@@ -889,7 +1054,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	//if the spelltrap effect already absorbed enough levels
 	//but still didn't get removed, it will absorb levels it shouldn't
 	//it will also absorb multiple spells in a single round
-	if (fx.Power && fx.Resistance != FX_NO_RESIST_BYPASS_BOUNCE) {
+	if (fx.Power && (protections & PROT_SPELLTRAP) && fx.Resistance != FX_NO_RESIST_BYPASS_BOUNCE) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParamPair(fx_spelltrap, 0, fx.Power));
 		if( efx) {
 			//storing the absorbed spell level
@@ -911,30 +1076,30 @@ static int check_type(Actor *actor, const Effect& fx)
 	}
 
 	if (fx.Power) {
-		if ((bounce & BNC_LEVEL) && actor->fxqueue.HasEffectWithParamPair(fx_level_bounce_ref, 0, fx.Power)) {
+		if ((bounce & BNC_LEVEL) && (protections & BOUNCE_LEVEL) && actor->fxqueue.HasEffectWithParamPair(fx_level_bounce_ref, 0, fx.Power)) {
 			Log(DEBUG, "EffectQueue", "Bounced by level");
 			return -1;
 		}
 	}
 
-	if ((bounce & BNC_PROJECTILE) && actor->fxqueue.HasEffectWithParam(fx_projectile_bounce_ref, fx.Projectile)) {
+	if ((bounce & BNC_PROJECTILE) && (protections & BOUNCE_PROJECTILE) && actor->fxqueue.HasEffectWithParam(fx_projectile_bounce_ref, fx.Projectile)) {
 		Log(DEBUG, "EffectQueue", "Bounced by projectile");
 		return -1;
 	}
 
-	if (!fx.SourceRef.IsEmpty() && (bounce & BNC_RESOURCE) && actor->fxqueue.HasEffectWithResource(fx_spell_bounce_ref, fx.SourceRef)) {
+	if (!fx.SourceRef.IsEmpty() && (bounce & BNC_RESOURCE) && (protections & BOUNCE_SPELL) && actor->fxqueue.HasEffectWithResource(fx_spell_bounce_ref, fx.SourceRef)) {
 		Log(DEBUG, "EffectQueue", "Bounced by resource");
 		return -1;
 	}
 
-	if (fx.PrimaryType && (bounce & BNC_SCHOOL)) {
+	if (fx.PrimaryType && (bounce & BNC_SCHOOL) && (protections & BOUNCE_SCHOOL)) {
 		if (actor->fxqueue.HasEffectWithParam(fx_school_bounce_ref, fx.PrimaryType)) {
 			Log(DEBUG, "EffectQueue", "Bounced by school");
 			return -1;
 		}
 	}
 
-	if (fx.SecondaryType && (bounce & BNC_SECTYPE)) {
+	if (fx.SecondaryType && (bounce & BNC_SECTYPE) && (protections & BOUNCE_SECTYPE)) {
 		if (actor->fxqueue.HasEffectWithParam(fx_secondary_type_bounce_ref, fx.SecondaryType)) {
 			Log(DEBUG, "EffectQueue", "Bounced by usage/sectype");
 			return -1;
@@ -943,7 +1108,7 @@ static int check_type(Actor *actor, const Effect& fx)
 	//decrementing bounce checks
 
 	//level decrementing bounce check
-	if (fx.Power && bounce & BNC_LEVEL_DEC) {
+	if (fx.Power && (bounce & BNC_LEVEL_DEC) && (protections & BOUNCE_LEVEL_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParamPair(fx_level_bounce_dec_ref, 0, fx.Power));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Bounced by level (decrementing)");
@@ -951,7 +1116,7 @@ static int check_type(Actor *actor, const Effect& fx)
 		}
 	}
 
-	if (!fx.SourceRef.IsEmpty() && (bounce & BNC_RESOURCE_DEC)) {
+	if (!fx.SourceRef.IsEmpty() && (bounce & BNC_RESOURCE_DEC) && (protections & BOUNCE_SPELL_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithResource(fx_spell_bounce_dec_ref, fx.Resource));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Bounced by resource (decrementing)");
@@ -959,7 +1124,7 @@ static int check_type(Actor *actor, const Effect& fx)
 		}
 	}
 
-	if (fx.PrimaryType && (bounce & BNC_SCHOOL_DEC)) {
+	if (fx.PrimaryType && (bounce & BNC_SCHOOL_DEC) && (protections & BOUNCE_SCHOOL_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParam(fx_school_bounce_dec_ref, fx.PrimaryType));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Bounced by school (decrementing)");
@@ -967,7 +1132,7 @@ static int check_type(Actor *actor, const Effect& fx)
 		}
 	}
 
-	if (fx.SecondaryType && (bounce & BNC_SECTYPE_DEC)) {
+	if (fx.SecondaryType && (bounce & BNC_SECTYPE_DEC) && (protections & BOUNCE_SECTYPE_DEC)) {
 		efx = const_cast<Effect*>(actor->fxqueue.HasEffectWithParam(fx_secondary_type_bounce_dec_ref, fx.SecondaryType));
 		if (efx && DecreaseEffect(efx)) {
 			Log(DEBUG, "EffectQueue", "Bounced by usage (decrementing)");
@@ -1286,10 +1451,6 @@ int EffectQueue::ApplyEffect(Actor* target, Effect* fx, ieDword first_apply, ieD
 	return res;
 }
 
-// looks for opcode with param2
-
-#define MATCH_OPCODE() if (fx.Opcode != opcode) { continue; }
-
 // useful for: remove equipped item
 #define MATCH_SLOTCODE() if (fx.InventorySlot != slotcode) { continue; }
 
@@ -1312,8 +1473,7 @@ static inline bool IsLive(ieByte timingmode)
 //will be killed along with it
 void EffectQueue::RemoveAllEffects(ieDword opcode)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		fx.TimingMode = FX_DURATION_JUST_EXPIRED;
@@ -1324,7 +1484,7 @@ void EffectQueue::RemoveAllEffects(ieDword opcode)
 bool EffectQueue::RemoveEquippingEffects(ieDwordSigned slotcode)
 {
 	bool removed = false;
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		if (!IsEquipped(fx.TimingMode)) continue;
 		MATCH_SLOTCODE()
 
@@ -1337,7 +1497,7 @@ bool EffectQueue::RemoveEquippingEffects(ieDwordSigned slotcode)
 //removes all effects that match projectile
 void EffectQueue::RemoveAllEffectsWithProjectile(ieDword projectile)
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		MATCH_PROJECTILE()
 
 		fx.TimingMode = FX_DURATION_JUST_EXPIRED;
@@ -1347,7 +1507,7 @@ void EffectQueue::RemoveAllEffectsWithProjectile(ieDword projectile)
 //remove effects belonging to a given spell
 void EffectQueue::RemoveAllEffects(const ResRef &removed)
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		MATCH_LIVE_FX()
 		if (removed != fx.SourceRef) {
 			continue;
@@ -1400,7 +1560,7 @@ void EffectQueue::RemoveAllEffects(const ResRef &removed)
 //remove effects belonging to a given spell, but only if they match timing method x
 void EffectQueue::RemoveAllEffects(const ResRef &removed, ieByte timing)
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		MATCH_TIMING()
 		if (removed != fx.SourceRef) {
 			continue;
@@ -1423,8 +1583,7 @@ void EffectQueue::RemoveAllEffects(EffectRef &effect_reference)
 //Removes all effects with a matching resource field
 void EffectQueue::RemoveAllEffectsWithResource(ieDword opcode, const ResRef &resource)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (fx.Resource != resource) { continue; }
 
@@ -1442,8 +1601,7 @@ void EffectQueue::RemoveAllEffectsWithResource(EffectRef &effect_reference, cons
 //Removes all effects with a matching resource field
 void EffectQueue::RemoveAllEffectsWithSource(ieDword opcode, const ResRef &source, int mode)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		if (fx.SourceRef != source) continue;
 
 		// equipping effects only
@@ -1473,8 +1631,7 @@ void EffectQueue::RemoveAllEffectsWithSource(EffectRef &effectReference, const R
 //(works only if a higher stat means good for the target)
 void EffectQueue::RemoveAllDetrimentalEffects(ieDword opcode, ieDword current)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		switch (fx.Parameter2) {
@@ -1507,8 +1664,7 @@ void EffectQueue::RemoveAllDetrimentalEffects(EffectRef &effect_reference, ieDwo
 //opcode need to be removed (see removal of portrait icon)
 void EffectQueue::RemoveAllEffectsWithParam(ieDword opcode, ieDword param2)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 
@@ -1526,8 +1682,7 @@ void EffectQueue::RemoveAllEffectsWithParam(EffectRef &effect_reference, ieDword
 //Removes all effects with a matching resource field
 void EffectQueue::RemoveAllEffectsWithParamAndResource(ieDword opcode, ieDword param2, const ResRef &resource)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 		
@@ -1556,7 +1711,7 @@ void EffectQueue::RemoveExpiredEffects(ieDword futuretime)
 		GameTime += futuretime;
 	}
 
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		//FIXME: how this method handles delayed effects???
 		//it should remove them as well, i think
 		if (DelayType(fx.TimingMode) != TIMING_PERMANENT && fx.Duration <= GameTime) {
@@ -1569,7 +1724,7 @@ void EffectQueue::RemoveExpiredEffects(ieDword futuretime)
 //which i call permanent after death (iesdp calls it permanent after bonuses)
 void EffectQueue::RemoveAllNonPermanentEffects()
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		if (IsRemovable(fx.TimingMode)) {
 			fx.TimingMode = FX_DURATION_JUST_EXPIRED;
 		}
@@ -1582,7 +1737,7 @@ void EffectQueue::RemoveAllNonPermanentEffects()
 void EffectQueue::RemoveLevelEffects(ieDword level, ieDword Flags, ieDword match)
 {
 	ResRef removed;
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		if (fx.Power > level) {
 			continue;
 		}
@@ -1610,7 +1765,7 @@ void EffectQueue::RemoveLevelEffects(ieDword level, ieDword Flags, ieDword match
 
 void EffectQueue::DispelEffects(const Effect *dispeller, ieDword level)
 {
-	for (auto& fx : effects) {
+	for (auto& fx : Effects()) {
 		if (&fx == dispeller) continue;
 
 		// this should also ignore all equipping effects
@@ -1639,8 +1794,7 @@ void EffectQueue::DispelEffects(const Effect *dispeller, ieDword level)
 
 const Effect *EffectQueue::HasOpcode(ieDword opcode) const
 {
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		return &fx;
@@ -1659,8 +1813,7 @@ const Effect *EffectQueue::HasEffect(EffectRef &effect_reference) const
 
 Effect *EffectQueue::HasOpcode(ieDword opcode)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		return &fx;
@@ -1679,8 +1832,7 @@ Effect *EffectQueue::HasEffect(EffectRef &effect_reference)
 
 const Effect *EffectQueue::HasOpcodeWithParam(ieDword opcode, ieDword param2) const
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 
@@ -1704,8 +1856,7 @@ const Effect *EffectQueue::HasEffectWithParam(EffectRef &effect_reference, ieDwo
 
 const Effect *EffectQueue::HasOpcodeWithParamPair(ieDword opcode, ieDword param1, ieDword param2) const
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 		//0 is always accepted as first parameter
@@ -1731,8 +1882,7 @@ const Effect *EffectQueue::HasEffectWithParamPair(EffectRef &effect_reference, i
 //this could be used for stoneskins and mirror images as well
 void EffectQueue::DecreaseParam1OfEffect(ieDword opcode, ieDword amount)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		ieDword value = fx.Parameter1;
 		if( value>amount) {
@@ -1762,8 +1912,7 @@ void EffectQueue::DecreaseParam1OfEffect(EffectRef &effect_reference, ieDword am
 //returns the damage amount NOT soaked
 int EffectQueue::DecreaseParam3OfEffect(ieDword opcode, ieDword amount, ieDword param2)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 		ieDword value = fx.Parameter3;
@@ -1801,8 +1950,7 @@ static const int ids_stats[9]={IE_FACTION, IE_TEAM, IE_EA, IE_GENERAL, IE_RACE,
 int EffectQueue::BonusAgainstCreature(ieDword opcode, const Actor *actor) const
 {
 	ieDword sum = 0;
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (fx.Parameter1) {
 			ieDword param1;
@@ -1853,8 +2001,7 @@ int EffectQueue::BonusAgainstCreature(EffectRef &effect_reference, const Actor *
 int EffectQueue::BonusForParam2(ieDword opcode, ieDword param2) const
 {
 	int sum = 0;
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		MATCH_PARAM2()
 		sum += fx.Parameter1;
@@ -1875,8 +2022,7 @@ int EffectQueue::MaxParam1(ieDword opcode, bool positive) const
 {
 	int max = 0;
 	ieDwordSigned param1 = 0;
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		param1 = signed(fx.Parameter1);
@@ -1898,8 +2044,7 @@ int EffectQueue::MaxParam1(EffectRef &effect_reference, bool positive) const
 
 bool EffectQueue::WeaponImmunity(ieDword opcode, int enchantment, ieDword weapontype) const
 {
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		int magic = (int) fx.Parameter1;
@@ -1938,8 +2083,7 @@ void EffectQueue::AddWeaponEffects(EffectQueue* fxqueue, EffectRef& fx_ref, ieDw
 	ieDword opcode = fx_ref.opcode;
 	Point p(-1,-1);
 
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (!param2 && fx.Parameter2 != param2) continue;
 
@@ -1958,8 +2102,7 @@ int EffectQueue::SumDamageReduction(EffectRef &effect_reference, ieDword weaponE
 	int remaining = 0;
 	int count = 0;
 
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 
 		count++;
@@ -1979,8 +2122,7 @@ int EffectQueue::SumDamageReduction(EffectRef &effect_reference, ieDword weaponE
 //useful for immunity vs spell, can't use item, etc.
 const Effect *EffectQueue::HasOpcodeWithResource(ieDword opcode, const ResRef &resource) const
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (fx.Resource != resource) continue;
 
@@ -2004,8 +2146,7 @@ const Effect *EffectQueue::HasEffectWithPower(EffectRef &effect_reference, ieDwo
 
 const Effect *EffectQueue::HasOpcodeWithPower(ieDword opcode, ieDword power) const
 {
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		// NOTE: matching greater or equals!
 		if (fx.Power < power) continue;
@@ -2018,7 +2159,7 @@ const Effect *EffectQueue::HasOpcodeWithPower(ieDword opcode, ieDword power) con
 //returns the first effect with source 'Removed'
 const Effect *EffectQueue::HasSource(const ResRef &removed) const
 {
-	for (const auto& fx : effects) {
+	for (const auto& fx : Effects()) {
 		MATCH_LIVE_FX()
 		if (removed != fx.SourceRef) {
 			continue;
@@ -2032,8 +2173,7 @@ const Effect *EffectQueue::HasSource(const ResRef &removed) const
 //used in contingency/sequencer code (cannot have the same contingency twice)
 const Effect *EffectQueue::HasOpcodeWithSource(ieDword opcode, const ResRef &removed) const
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (removed != fx.SourceRef) {
 			continue;
@@ -2052,7 +2192,7 @@ const Effect *EffectQueue::HasEffectWithSource(EffectRef &effect_reference, cons
 
 bool EffectQueue::HasAnyDispellableEffect() const
 {
-	for (const Effect& fx : effects) {
+	for (const Effect& fx : Effects()) {
 		if (fx.Resistance & FX_CAN_DISPEL) {
 			return true;
 		}
@@ -2065,7 +2205,7 @@ std::string EffectQueue::dump(bool print) const
 	std::string buffer("EFFECT QUEUE:\n");
 	int i = 0;
 	const auto& Opcodes = Globals::Get().Opcodes;
-	for (const Effect& fx : effects) {
+	for (const Effect& fx : Effects()) {
 		if (fx.Opcode >= Globals::MAX_EFFECTS) {
 			Log(FATAL, "EffectQueue", "Encountered opcode off the charts: {}! Report this immediately!", fx.Opcode);
 			return buffer;
@@ -2091,11 +2231,11 @@ void EffectQueue::HackColorEffects(const Actor *Owner, Effect *fx)
 }
 
 //iterate through saved effects
-const Effect *EffectQueue::GetNextSavedEffect(queue_t::const_iterator &f) const
+const Effect *EffectQueue::GetNextSavedEffect(const_iterator &f) const
 {
-	while(f!=effects.end()) {
+	while (!f.AtEnd()) {
 		const Effect& effect = *f;
-		f++;
+		++f;
 		if (effect.Persistent()) {
 			return &effect;
 		}
@@ -2103,24 +2243,27 @@ const Effect *EffectQueue::GetNextSavedEffect(queue_t::const_iterator &f) const
 	return nullptr;
 }
 
-const Effect *EffectQueue::GetNextEffect(queue_t::const_iterator &f) const
+const Effect *EffectQueue::GetNextEffect(const_iterator &f) const
 {
-	if( f!=effects.end()) return &(*f++);
-	return nullptr;
+	if (f.AtEnd()) return nullptr;
+	const Effect* fx = &*f;
+	++f;
+	return fx;
 }
 
-Effect *EffectQueue::GetNextEffect(queue_t::iterator &f)
+Effect *EffectQueue::GetNextEffect(iterator &f)
 {
-	if( f!=effects.end()) return &(*f++);
-	return nullptr;
+	if (f.AtEnd()) return nullptr;
+	Effect* fx = &*f;
+	++f;
+	return fx;
 }
 
 ieDword EffectQueue::CountEffects(ieDword opcode, ieDword param1, ieDword param2, const ResRef &resource) const
 {
 	ieDword cnt = 0;
 
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		if( param1!=0xffffffff)
 			MATCH_PARAM1()
 		if( param2!=0xffffffff)
@@ -2136,8 +2279,7 @@ unsigned int EffectQueue::GetEffectOrder(EffectRef& effect_reference, const Effe
 	ieDword cnt = 1;
 	ieDword opcode = ResolveEffect(effect_reference);
 
-	for (const auto& fx : effects) {
-		MATCH_OPCODE()
+	for (const auto& fx : OpcodeEffects(opcode)) {
 		MATCH_LIVE_FX()
 		if (&fx == fx2) break;
 		cnt++;
@@ -2147,8 +2289,7 @@ unsigned int EffectQueue::GetEffectOrder(EffectRef& effect_reference, const Effe
 
 void EffectQueue::ModifyEffectPoint(ieDword opcode, ieDword x, ieDword y)
 {
-	for (auto& fx : effects) {
-		MATCH_OPCODE()
+	for (auto& fx : OpcodeEffects(opcode)) {
 		fx.Pos = Point(x, y);
 		fx.Parameter3 = 0;
 		return;
@@ -2160,7 +2301,7 @@ ieDword EffectQueue::GetSavedEffectsCount() const
 {
 	ieDword cnt = 0;
 
-	for (const auto& fx : effects) {
+	for (const auto& fx : Effects()) {
 		if (fx.Persistent()) cnt++;
 	}
 	return cnt;
@@ -2185,8 +2326,8 @@ int EffectQueue::CheckImmunity(Actor *target) const
 		return 1;
 	}
 
-	if (!effects.empty()) {
-		const Effect& fx = *effects.begin();
+	if (!order.empty()) {
+		const Effect& fx = Slot(order.front());
 
 		//projectile immunity
 		if( target->ImmuneToProjectile(fx.Projectile)) return 0;
@@ -2239,11 +2380,19 @@ bool EffectQueue::OverrideTarget(const Effect *fx)
 	return (Opcodes[fx->Opcode].Flags & EFFECT_PRESET_TARGET);
 }
 
+ieDword EffectQueue::Protections() const
+{
+	if (indexStale) {
+		RefreshIndex();
+	}
+	return protections;
+}
+
 bool EffectQueue::HasHostileEffects() const
 {
 	bool hostile = false;
 
-	for (const Effect& fx : effects) {
+	for (const Effect& fx : Effects()) {
 		if (fx.SourceFlags&SF_HOSTILE) {
 			hostile = true;
 			break;
@@ -36,7 +36,9 @@
 #include "Logging/Logging.h"
 
 #include <cstdlib>
-#include <list>
+#include <map>
+#include <memory>
+#include <vector>
 
 namespace GemRB {
 
@@ -214,19 +216,87 @@ bool IsColorslotEffect(int opcode);
 
 class GEM_EXPORT EffectQueue {
 private:
-	/** List of Effects applied on the Actor */
-	using queue_t = std::list<Effect>;
-	queue_t effects;
+	using slot_t = uint32_t;
+	using slots_t = std::vector<slot_t>;
+	static constexpr slot_t CHUNK_SIZE = 16;
+	/** the first chunks hold 1, 2, 4 and 8 slots, so short queues stay small */
+	static constexpr slot_t SMALL_CHUNKS = 4;
+	static constexpr slot_t SMALL_SLOTS = CHUNK_SIZE - 1;
+
+	/** Effects applied on the Actor, stored in chunks. Slots never move,
+	 * so Effect pointers stay valid while the queue grows (effects often
+	 * add others while being applied); Cleanup recycles expired slots */
+	std::vector<std::unique_ptr<Effect[]>> chunks;
+	slot_t slotCount = 0;
+	slots_t freeSlots;
+	/** slot ids in queue order, this is also the order effects get saved in */
+	slots_t order;
+	/** slot ids per opcode in queue order, so lookups skip unrelated effects.
+	 * A map, so buckets stay put for running iterations when opcodes get added */
+	mutable std::map<ieDword, slots_t> opcodeIndex;
+	mutable bool indexStale = false;
+	/** kinds of immunity and bounce effects in the queue, kept along with the index */
+	mutable ieDword protections = 0;
+	/** counts insertions at the front, so running iterations can step over them */
+	size_t frontInserts = 0;
 	/** Actor which is target of the Effects */
 	Scriptable* Owner = nullptr;
 
+	/** walks a list of slot ids, picking up effects appended while iterating */
+	template <typename QUEUE, typename FX>
+	class Iterator {
+		QUEUE* queue = nullptr;
+		const slots_t* ids = nullptr;
+		size_t pos = 0;
+		size_t fronts = 0;
+
+	public:
+		Iterator(QUEUE* q, const slots_t* list) noexcept
+		: queue(q), ids(list), fronts(q->frontInserts) {}
+
+		FX& operator*() const { return queue->Slot((*ids)[pos]); }
+		FX* operator->() const { return &**this; }
+
+		Iterator& operator++() {
+			if (ids == &queue->order) {
+				pos += queue->frontInserts - fronts;
+				fronts = queue->frontInserts;
+			}
+			++pos;
+			return *this;
+		}
+
+		bool AtEnd() const { return pos >= ids->size(); }
+		// only ever compared against end() of the same range
+		bool operator!=(const Iterator&) const { return !AtEnd(); }
+	};
+
+	template <typename QUEUE, typename FX>
+	struct Range {
+		Iterator<QUEUE, FX> first;
+
+		Iterator<QUEUE, FX> begin() const { return first; }
+		Iterator<QUEUE, FX> end() const { return first; }
+	};
+
 public:
+	using iterator = Iterator<EffectQueue, Effect>;
+	using const_iterator = Iterator<const EffectQueue, const Effect>;
+
 	EffectQueue() noexcept {};
+	EffectQueue(const EffectQueue&);
+	EffectQueue(EffectQueue&&) noexcept = default;
+	EffectQueue& operator=(const EffectQueue&);
+	EffectQueue& operator=(EffectQueue&&) noexcept = default;
 	
 	explicit operator bool() const {
-		return !effects.empty();
+		return !order.empty();
 	}
 
+	/** all effects in queue order */
+	Range<EffectQueue, Effect> Effects() { return { iterator(this, &order) }; }
+	Range<const EffectQueue, const Effect> Effects() const { return { const_iterator(this, &order) }; }
+
 	/** Sets Actor which is affected by these effects */
 	void SetOwner(Scriptable* act) { Owner = act; }
 	/** Returns Actor affected by these effects */
@@ -279,25 +349,25 @@ public:
 	void DispelEffects(const Effect *dispeller, ieDword level);
 
 	/* returns next saved effect, increases index */
-	queue_t::iterator GetFirstEffect()
+	iterator GetFirstEffect()
 	{
-		return effects.begin();
+		return iterator(this, &order);
 	}
 	
-	queue_t::const_iterator GetFirstEffect() const
+	const_iterator GetFirstEffect() const
 	{
-		return effects.begin();
+		return const_iterator(this, &order);
 	}
 	
-	const Effect *GetNextSavedEffect(queue_t::const_iterator &f) const;
-	const Effect *GetNextEffect(queue_t::const_iterator &f) const;
-	Effect *GetNextEffect(queue_t::iterator &f);
+	const Effect *GetNextSavedEffect(const_iterator &f) const;
+	const Effect *GetNextEffect(const_iterator &f) const;
+	Effect *GetNextEffect(iterator &f);
 	ieDword CountEffects(EffectRef &effect_reference, ieDword param1, ieDword param2, const ResRef& = ResRef()) const;
 	void ModifyEffectPoint(EffectRef &effect_reference, ieDword x, ieDword y);
 	void ModifyAllEffectSources(const Point &source);
 	/* returns the number of saved effects */
 	ieDword GetSavedEffectsCount() const;
-	size_t GetEffectsCount() const { return effects.size(); }
+	size_t GetEffectsCount() const { return order.size(); }
 	unsigned int GetEffectOrder(EffectRef &effect_reference, const Effect *fx2) const;
 	/* this method hacks the offhand weapon color effects */
 	static void HackColorEffects(const Actor *Owner, Effect *fx);
@@ -341,8 +411,30 @@ public:
 	/** just checks if it is a particularly stupid effect that needs its target reset */
 	static bool OverrideTarget(const Effect *fx);
 	bool HasHostileEffects() const;
+	/** bits of the immunity and bounce kinds present (expired ones may linger until Cleanup) */
+	ieDword Protections() const;
 	static bool CheckIWDTargeting(Scriptable* Owner, Actor* target, ieDword value, ieDword type, Effect *fx = nullptr);
 private:
+	static slot_t ChunkCapacity(slot_t chunk) { return chunk < SMALL_CHUNKS ? 1 << chunk : CHUNK_SIZE; }
+	static slot_t ChunkOf(slot_t slot, slot_t& offset)
+	{
+		if (slot >= SMALL_SLOTS) {
+			offset = (slot - SMALL_SLOTS) % CHUNK_SIZE;
+			return SMALL_CHUNKS + (slot - SMALL_SLOTS) / CHUNK_SIZE;
+		}
+		slot_t n = slot + 1;
+		slot_t chunk = n >= 8 ? 3 : n >= 4 ? 2 : n >= 2 ? 1 : 0;
+		offset = n - (1 << chunk);
+		return chunk;
+	}
+	Effect& Slot(slot_t slot) { slot_t offset; slot_t chunk = ChunkOf(slot, offset); return chunks[chunk][offset]; }
+	const Effect& Slot(slot_t slot) const { slot_t offset; slot_t chunk = ChunkOf(slot, offset); return chunks[chunk][offset]; }
+	/** effects with the given opcode, in queue order */
+	Range<EffectQueue, Effect> OpcodeEffects(ieDword opcode) { return { iterator(this, &OpcodeSlots(opcode)) }; }
+	Range<const EffectQueue, const Effect> OpcodeEffects(ieDword opcode) const { return { const_iterator(this, &OpcodeSlots(opcode)) }; }
+	const slots_t& OpcodeSlots(ieDword opcode) const;
+	slots_t& OpcodeBucket(ieDword opcode) const;
+	void RefreshIndex() const;
 	/** counts effects of specific opcode, parameters and resource */
 	ieDword CountEffects(ieDword opcode, ieDword param1, ieDword param2, const ResRef& = ResRef()) const;
 	void ModifyEffectPoint(ieDword opcode, ieDword x, ieDword y);
@@ -33,6 +33,7 @@
 #include "KeyMap.h"
 #include "PathFinder.h"
 #include "ScriptEngine.h"
+#include "Settings.h"
 #include "TileMap.h"
 #include "Video/Video.h"
 #include "damages.h"
@@ -149,6 +150,36 @@ Point GameControl::GetFormationOffset(size_t formation, uint8_t pos) const
 	return Formations::GetFormation(formation)[pos];
 }
 
+// the sweep GetFormationPoint does around a blocked formation point:
+// an M_PI arc a `radius` away from the point, then wider arcs with more,
+// smaller steps, since we have more area to fit
+struct FormationSweepStep {
+	int step; // how many `radius` the arc is away
+	double angle;
+};
+
+static std::vector<FormationSweepStep> MakeFormationSweep()
+{
+	static constexpr int maxStep = 4;
+	std::vector<FormationSweepStep> sweep;
+	for (int step = 0; step < maxStep; ++step) {
+		// each wider arc starts back at the formation point's side
+		if (step) sweep.push_back({ step, 0.0 });
+		int slices = 4 * (step + 1);
+		// both arc end points are included, the old incremental sweep could miss one due to rounding
+		for (int i = 1; i <= slices; ++i) {
+			sweep.push_back({ step, M_PI * i / slices });
+		}
+	}
+	return sweep;
+}
+
+static const std::vector<FormationSweepStep>& GetFormationSweep()
+{
+	static const std::vector<FormationSweepStep> sweep = MakeFormationSweep();
+	return sweep;
+}
+
 Point GameControl::GetFormationPoint(const Point& origin, size_t pos, double angle, const std::vector<Point>& exclude) const
 {
 	Point vec;
@@ -161,7 +192,6 @@ Point GameControl::GetFormationPoint(const Point& origin, size_t pos, double ang
 	const auto& formationid = game->GetFormation();
 	const auto& formation = Formations::GetFormation(formationid);
 	
-	Point stepVec;
 	int direction = (pos % 2 == 0) ? 1 : -1;
 
 	/* Correct for the innate orientation of the points.  */
@@ -170,7 +200,6 @@ Point GameControl::GetFormationPoint(const Point& origin, size_t pos, double ang
 	if (pos < FORMATIONSIZE) {
 		// calculate new coordinates by rotating formation around (0,0)
 		vec = RotatePoint(formation[pos], angle);
-		stepVec.y = radius;
 	} else {
 		
 		// create a line formation perpendicular to the formation start point and beginning at the last point
@@ -178,67 +207,38 @@ Point GameControl::GetFormationPoint(const Point& origin, size_t pos, double ang
 		// the formation table is created along the x axis starting at (0,0)
 		Point p = formation[FORMATIONSIZE - 1];
 		vec = RotatePoint(p, angle);
-		stepVec.x = radius * direction;
 	}
 	
-	Point dest = vec + origin;
-	int step = 0;
-	constexpr int maxStep = 4;
-	double stepAngle = 0.0;
-	const Point& start = vec;
-	
-	auto NextDest = [&]() {
-		// adjust the point if the actor cant get to `dest`
-		// we do this by sweeping an M_PI arc a `radius` (stepVec) away from the point
-		// and oriented according to `direction`
-		// if nothing is found, reset to `start` and increase the `stepVec` and sweep again
-		// each incremental sweep step the `stepAngle` increment shrinks because we have more area to fit
-		// if nothing is found after `maxStep` sweeps we just give up and leave it to the path finder to work out
-		
-		// FIXME: we should precalculate these into a table and use step as an index
-		// there is a precission/rounding problem here with comparing against M_PI
-		// and we may not use one of the arc end points
-		stepAngle += (M_PI_4 / (step + 1)) * direction;
-		if (stepAngle > M_PI || stepAngle < -M_PI) {
-			++step;
-			stepAngle = 0.0;
-			if (stepVec.y != 0) {
-				stepVec.y += radius;
-			} else {
-				stepVec.x += radius * direction;
-			}
-		}
-		
-		return origin + start + RotatePoint(stepVec, angle + stepAngle);
-	};
-
-	while (step < maxStep) {
+	auto IsUsable = [&](const Point& dest) {
 		auto it = std::find_if(exclude.begin(), exclude.end(), [&](const Point& p) {
 			// look for points within some radius
 			return p.isWithinRadius(radius, dest);
 		});
+		if (it != exclude.end()) return false;
+		return area->IsExplored(dest) && bool(area->GetBlocked(dest) & PathMapFlags::PASSABLE);
+	};
 
-		if (it != exclude.end()) {
-			dest = NextDest();
-			continue;
-		}
-		
-		if (area->IsExplored(dest) == false || !(area->GetBlocked(dest) & PathMapFlags::PASSABLE)) {
-			dest = NextDest();
-			continue;
+	Point dest = vec + origin;
+	if (IsUsable(dest)) return dest;
+
+	// adjust the point if the actor cant get to `dest`
+	// sweep arcs oriented according to `direction` around it
+	// if nothing is found after all the sweeps we just give up and leave it to the path finder to work out
+	for (const auto& sweep : GetFormationSweep()) {
+		Point stepVec;
+		if (pos < FORMATIONSIZE) {
+			stepVec.y = radius * (sweep.step + 1);
+		} else {
+			stepVec.x = radius * (sweep.step + 1) * direction;
 		}
-		
-		break;
-	}
-	
-	if (step == maxStep) {
-		// we never found a suitable point
-		// to garauntee a point that is reachable just fall back to origin
-		// let the pathfinder sort it out
-		return origin;
+		dest = origin + vec + RotatePoint(stepVec, angle + sweep.angle * direction);
+		if (IsUsable(dest)) return dest;
 	}
-	
-	return dest;
+
+	// we never found a suitable point
+	// to garauntee a point that is reachable just fall back to origin
+	// let the pathfinder sort it out
+	return origin;
 }
 
 GameControl::FormationPoints GameControl::GetFormationPoints(const Point& origin, const std::vector<Actor*>& actors,
@@ -275,17 +275,17 @@ void GameControl::CreateMovement(Actor *actor, const Point &p, bool append, bool
 	tryToRun |= AlwaysRun;
 	
 	if (append) {
-		action = GenerateAction(fmt::format("AddWayPoint([{}.{}])", p.x, p.y));
+		action = MakeAction(ActionID::AddWayPoint).At(p);
 		assert(action);
 	} else {
 		//try running (in PST) only if not encumbered
 		if (tryToRun && CanRun(actor)) {
-			action = GenerateAction(fmt::format("RunToPoint([{}.{}])", p.x, p.y));
+			action = MakeAction(ActionID::RunToPoint).At(p);
 		}
 		
-		// check again because GenerateAction can fail (non PST)
+		// check again because RunToPoint can be missing (non PST)
 		if (!action) {
-			action = GenerateAction(fmt::format("MoveToPoint([{}.{}])", p.x, p.y));
+			action = MakeAction(ActionID::MoveToPoint).At(p);
 		}
 	}
 
@@ -443,7 +443,7 @@ void GameControl::WillDraw(const Region& /*drawFrame*/, const Region& /*clip*/)
 	assert(area);
 
 	int flags = GA_NO_DEAD|GA_NO_UNSCHEDULED|GA_SELECT|GA_NO_ENEMY|GA_NO_NEUTRAL;
-	auto ab = area->GetActorsInRect(SelectionRect(), flags);
+	auto ab = area->PickActorsInRect(SelectionRect(), flags);
 
 	std::vector<Actor*>::iterator it = highlighted.begin();
 	for (; it != highlighted.end(); ++it) {
@@ -598,21 +598,32 @@ void GameControl::DrawSelf(const Region& screen, const Region& /*clip*/)
 
 	// Draw path
 	if (drawPath) {
+		// long paths have many segments, so submit them as one batch
+		std::vector<Point> segments;
+		std::vector<Color> segmentColors;
+		std::vector<Point> ends;
+		std::vector<Color> endColors;
 		PathListNode* node = drawPath;
 		while (true) {
 			Point p = Map::ConvertCoordFromTile(node->point) + Point(8, 6);
 			if (!node->Parent) {
-				video->DrawCircle( p, 2, ColorRed );
+				ends.push_back(p);
+				endColors.push_back(ColorRed);
 			} else {
 				Point old = Map::ConvertCoordFromTile(node->Parent->point) + Point(8, 6);
-				video->DrawLine(old, p, ColorGreen);
+				segments.push_back(old);
+				segments.push_back(p);
+				segmentColors.push_back(ColorGreen);
 			}
 			if (!node->Next) {
-				video->DrawCircle( p, 2, ColorGreen );
+				ends.push_back(p);
+				endColors.push_back(ColorGreen);
 				break;
 			}
 			node = node->Next;
 		}
+		video->DrawLineSegments(segments, segmentColors);
+		video->DrawCircles(ends, 2, endColors);
 	}
 
 	if (core->HasFeature(GF_ONSCREEN_TEXT) && !DisplayText.empty()) {
@@ -681,8 +692,7 @@ bool GameControl::OnKeyPress(const KeyboardEvent& Key, unsigned short mod)
 				case GEM_LEFT:
 				case GEM_RIGHT:
 					{
-						ieDword keyScrollSpd = 64;
-						core->GetDictionary()->Lookup("Keyboard Scroll Speed", keyScrollSpd);
+						int keyScrollSpd = Settings::KeyboardScrollSpeed;
 						if (keycode >= GEM_UP) {
 							int v = (keycode == GEM_UP) ? -1 : 1;
 							Scroll( Point(0, keyScrollSpd * v) );
@@ -868,7 +878,7 @@ bool GameControl::OnKeyRelease(const KeyboardEvent& Key, unsigned short Mod)
 			case 'k': //kicks out actor
 				if (lastActor && lastActor->InParty) {
 					lastActor->Stop();
-					lastActor->AddAction( GenerateAction("LeaveParty()") );
+					lastActor->AddAction( MakeAction(ActionID::LeaveParty) );
 				}
 				break;
 			case 'l': //play an animation (vvc/bam) over an actor
@@ -941,7 +951,7 @@ bool GameControl::OnKeyRelease(const KeyboardEvent& Key, unsigned short Mod)
 			case 'q': //joins actor to the party
 				if (lastActor && !lastActor->InParty) {
 					lastActor->Stop();
-					lastActor->AddAction( GenerateAction("JoinParty()") );
+					lastActor->AddAction( MakeAction(ActionID::JoinParty) );
 				}
 				break;
 			case 'r'://resurrects actor
@@ -1129,7 +1139,7 @@ String GameControl::TooltipText() const {
 		return View::TooltipText();
 	}
 
-	const Actor* actor = area->GetActor(gameMousePos, GA_NO_DEAD|GA_NO_UNSCHEDULED);
+	const Actor* actor = area->PickActor(gameMousePos, GA_NO_DEAD|GA_NO_UNSCHEDULED);
 	if (actor == NULL) {
 		return View::TooltipText();
 	}
@@ -1238,7 +1248,7 @@ bool GameControl::OnMouseOver(const MouseEvent& /*me*/)
 
 	Point gameMousePos = GameMousePos();
 	// let us target party members even if they are invisible
-	lastActor = area->GetActor(gameMousePos, GA_NO_DEAD|GA_NO_UNSCHEDULED);
+	lastActor = area->PickActor(gameMousePos, GA_NO_DEAD|GA_NO_UNSCHEDULED);
 	if (lastActor && lastActor->Modified[IE_EA] >= EA_CONTROLLED) {
 		if (!lastActor->ValidTarget(target_types) || !area->IsVisible(gameMousePos)) {
 			lastActor = NULL;
@@ -1852,8 +1862,7 @@ void GameControl::HandleContainer(Container *container, Actor *actor)
 	core->SetEventFlag(EF_RESETTARGET);
 
 	if (target_mode == TARGET_MODE_ATTACK) {
-		std::string Tmp = fmt::format("BashDoor(\"{}\")", container->GetScriptName());
-		actor->CommandActor(GenerateAction(std::move(Tmp)));
+		actor->CommandActor(MakeAction(ActionID::BashDoor).Named(container->GetScriptName()));
 		return;
 	}
 
@@ -1864,7 +1873,7 @@ void GameControl::HandleContainer(Container *container, Actor *actor)
 
 	container->AddTrigger(TriggerEntry(trigger_clicked, actor->GetGlobalID()));
 	core->SetCurrentContainer( actor, container);
-	actor->CommandActor(GenerateAction("UseContainer()"));
+	actor->CommandActor(MakeAction(ActionID::UseContainer));
 }
 
 //generate action code for actor appropriate for the target mode when the target is a door
@@ -1885,8 +1894,7 @@ void GameControl::HandleDoor(Door *door, Actor *actor)
 	core->SetEventFlag(EF_RESETTARGET);
 
 	if (target_mode == TARGET_MODE_ATTACK) {
-		std::string Tmp = fmt::format("BashDoor(\"{}\")", door->GetScriptName());
-		actor->CommandActor(GenerateAction(std::move(Tmp)));
+		actor->CommandActor(MakeAction(ActionID::BashDoor).Named(door->GetScriptName()));
 		return;
 	}
 
@@ -1898,7 +1906,7 @@ void GameControl::HandleDoor(Door *door, Actor *actor)
 	door->AddTrigger(TriggerEntry(trigger_clicked, actor->GetGlobalID()));
 	actor->TargetDoor = door->GetGlobalID();
 	// internal gemrb toggle door action hack - should we use UseDoor instead?
-	actor->CommandActor(GenerateAction("NIDSpecial9()"));
+	actor->CommandActor(MakeAction(ActionID::NIDSpecial9));
 }
 
 //generate action code for actor appropriate for the target mode when the target is an active region (infopoint, trap or travel)
@@ -1926,7 +1934,7 @@ bool GameControl::HandleActiveRegion(InfoPoint *trap, Actor * actor, const Point
 		case ST_TRIGGER:
 			// pst, eg. ar1500
 			if (!trap->GetDialog().IsEmpty()) {
-				trap->AddAction(GenerateAction("Dialogue([PC])"));
+				trap->AddAction(MakeAction(ActionID::Dialogue).EA(EA_PC));
 				return true;
 			}
 
@@ -1965,8 +1973,7 @@ bool GameControl::HandleActiveRegion(InfoPoint *trap, Actor * actor, const Point
 			}
 
 			if (trap->GetUsePoint() ) {
-				std::string Tmp = fmt::format("TriggerWalkTo(\"{}\")", trap->GetScriptName());
-				actor->CommandActor(GenerateAction(std::move(Tmp)));
+				actor->CommandActor(MakeAction(ActionID::TriggerWalkTo).Named(trap->GetScriptName()));
 				return true;
 			}
 			return true;
@@ -2176,7 +2183,7 @@ void GameControl::PerformSelectedAction(const Point& p)
 
 	const Game* game = core->GetGame();
 	const Map* area = game->GetCurrentArea();
-	Actor* targetActor = area->GetActor(p, target_types & ~GA_NO_HIDDEN);
+	Actor* targetActor = area->PickActor(p, target_types & ~GA_NO_HIDDEN);
 	if (targetActor) {
 		PerformActionOn(targetActor);
 		return;
@@ -2274,7 +2281,7 @@ void GameControl::CommandSelectedMovement(const Point& p, bool append, bool tryT
 
 	// p is a searchmap travel region or a plain travel region in pst (matching several other criteria)
 	if (party[0]->GetCurrentArea()->GetCursor(p) == IE_CURSOR_TRAVEL || doWorldMap) {
-		party[0]->AddAction(GenerateAction("NIDSpecial2()"));
+		party[0]->AddAction(MakeAction(ActionID::NIDSpecial2));
 	}
 }
 bool GameControl::OnMouseWheelScroll(const Point& delta)
@@ -2466,9 +2473,7 @@ void GameControl::SetCutSceneMode(bool active)
 void GameControl::DisplayString(const Scriptable* target) const
 {
 	// add as a "subtitle" to the main message window
-	ieDword tmp = 0;
-	core->GetDictionary()->Lookup("Duplicate Floating Text", tmp);
-	if (tmp && !target->GetOverheadText().empty()) {
+	if (Settings::DuplicateFloatingText && !target->GetOverheadText().empty()) {
 		// pass NULL target so pst does not display multiple
 		displaymsg->DisplayString(target->GetOverheadText());
 	}
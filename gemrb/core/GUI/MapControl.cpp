@@ -43,6 +43,7 @@ void MapControl::UpdateMap()
 	Map* newMap = core->GetGame()->GetCurrentArea();
 	if (newMap != MyMap) {
 		MyMap = newMap;
+		fogSprite = nullptr;
 		if (MyMap && MyMap->SmallMap) {
 			MapMOS = MyMap->SmallMap;
 		} else {
@@ -53,31 +54,76 @@ void MapControl::UpdateMap()
 	}
 }
 
-// Draw fog on the small bitmap
-void MapControl::DrawFog(const Region& rgn) const
+// Bring the fog mask up to date, only touching pixels of fog tiles that changed
+void MapControl::UpdateFog(const Size& size)
 {
-	Video *video = core->GetVideoDriver();
-	const Size mapsize = MyMap->GetSize();
-	Point p;
-	Point gameP = p;
-
-	std::vector<Point> points;
-	points.reserve(rgn.w * rgn.h);
-
-	for (; p.y < rgn.h; ++p.y) {
-		gameP.y = p.y * double(mapsize.h) / mosRgn.h;
+	const Bitmap& explored = MyMap->ExploredBitmap;
+	const Size fogSize = explored.GetSize();
+
+	bool rebuild = !fogSprite || fogSprite->Frame.size != size
+		|| fogMapID != MyMap->GetGlobalID() || fogExplored.size() != size_t(explored.Bytes());
+	if (rebuild) {
+		fogMapID = MyMap->GetGlobalID();
+		// all unexplored until told otherwise, this includes any pixels past the fog map
+		uint32_t* buffer = static_cast<uint32_t*>(malloc(size.w * size.h * 4));
+		std::fill(buffer, buffer + size.w * size.h, 0xff000000);
+		static const PixelFormat fmt(4, 0x000000ff, 0x0000ff00, 0x00ff0000, 0xff000000);
+		fogSprite = core->GetVideoDriver()->CreateSprite(Region(Point(), size), buffer, fmt);
+		fogExplored.assign(explored.Bytes(), 0);
+	} else if (fogGeneration == MyMap->ExploredGeneration()) {
+		return;
+	}
+	fogGeneration = MyMap->ExploredGeneration();
 
-		for (p.x = 0; p.x < rgn.w; ++p.x) {
-			gameP.x = p.x * double(mapsize.w) / mosRgn.w;
-			
-			bool visible = MyMap->IsExplored(gameP);
-			if (!visible) {
-				points.push_back(p + rgn.origin);
+	// the pixel rows and columns covered by each fog tile
+	const Size mapsize = MyMap->GetSize();
+	auto tileSpans = [](int pixels, int mapLen, int fogLen) {
+		std::vector<std::pair<int, int>> spans(fogLen, std::make_pair(0, 0));
+		for (int i = 0; i < pixels; ++i) {
+			int tile = int(i * double(mapLen) / pixels) / 32;
+			if (tile >= fogLen) break;
+			if (spans[tile].second == 0) {
+				spans[tile].first = i;
+			}
+			spans[tile].second = i + 1;
+		}
+		return spans;
+	};
+	const auto cols = tileSpans(size.w, mapsize.w, fogSize.w);
+	const auto rows = tileSpans(size.h, mapsize.h, fogSize.h);
+
+	uint8_t* pixels = static_cast<uint8_t*>(fogSprite->LockSprite());
+	const uint16_t pitch = fogSprite->GetPitch();
+	const uint8_t* bits = explored.begin();
+	for (int byte = 0; byte < explored.Bytes(); ++byte) {
+		uint8_t changed = bits[byte] ^ fogExplored[byte];
+		if (!changed && !rebuild) continue;
+		fogExplored[byte] = bits[byte];
+
+		for (int bit = 0; bit < 8; ++bit) {
+			if (!rebuild && !(changed & (1 << bit))) continue;
+			int idx = byte * 8 + bit;
+			if (idx >= fogSize.w * fogSize.h) break;
+
+			const auto& col = cols[idx % fogSize.w];
+			const auto& row = rows[idx / fogSize.w];
+			uint32_t px = (bits[byte] & (1 << bit)) ? 0 : 0xff000000;
+			for (int y = row.first; y < row.second; ++y) {
+				uint32_t* line = reinterpret_cast<uint32_t*>(pixels + y * pitch);
+				std::fill(line + col.first, line + col.second, px);
 			}
 		}
 	}
+	fogSprite->UnlockSprite();
+}
+
+// Draw fog on the small bitmap
+void MapControl::DrawFog(const Region& rgn)
+{
+	if (rgn.size.IsInvalid()) return;
 
-	video->DrawPoints(points, ColorBlack);
+	UpdateFog(rgn.size);
+	core->GetVideoDriver()->BlitSprite(fogSprite, rgn.origin);
 }
 	
 Point MapControl::ConvertPointToGame(Point p) const
@@ -31,6 +31,8 @@
 
 #include "exports.h"
 
+#include <vector>
+
 namespace GemRB {
 
 class Map;
@@ -56,6 +58,14 @@ private:
 	Point notePos;
 
 	AnimationFactory* mapFlags;
+
+	// mosRgn sized mask, opaque where the area is still unexplored
+	Holder<Sprite2D> fogSprite;
+	// ExploredBitmap as of the last fog update
+	std::vector<uint8_t> fogExplored;
+	unsigned int fogGeneration = 0;
+	// global ID of the map the mask was built for, a new map may reuse the address
+	ieDword fogMapID = 0;
 	
 public:
 	// Small map bitmap
@@ -85,7 +95,8 @@ private:
 	void WillDraw(const Region& /*drawFrame*/, const Region& /*clip*/) override;
 	/** Draws the Control on the Output Display */
 	void DrawSelf(const Region& drawFrame, const Region& clip) override;
-	void DrawFog(const Region& rgn) const;
+	void DrawFog(const Region& rgn);
+	void UpdateFog(const Size& size);
 	
 	Point ConvertPointToGame(Point) const;
 	Point ConvertPointFromGame(Point) const;
@@ -26,6 +26,7 @@
 
 #include <algorithm>
 #include <climits>
+#include <iterator>
 
 namespace GemRB {
 
@@ -359,12 +360,32 @@ void ContentContainer::DrawSelf(const Region& drawFrame, const Region& clip)
 	if (layout.empty()) return;
 	Point dp = drawFrame.origin + Point(margin.left, margin.top);
 	
-	ContentLayout::const_iterator it = layout.begin();
-	for (; it != layout.end(); ++it) {
-		const Layout& l = *it;
+	// layouts are ordered ltr-ttb, so we can stop at the first one starting below the clip
+	// long logs and dialogs are mostly scrolled out of view, so skip those not intersecting it
+	Region visible(clip.origin - dp, clip.size);
+	for (const Layout& l : layout) {
+		if (l.regions.empty()) {
+			// nothing to place or clip, but subclasses still count it (eg. the cursor position)
+			DrawContents(l, dp);
+			continue;
+		}
+		if (l.regions.front()->region.y >= visible.y + visible.h) {
+			break;
+		}
+
+		bool intersects = false;
+		for (const auto& lrgn : l.regions) {
+			if (lrgn->region.IntersectsRegion(visible)) {
+				intersects = true;
+				break;
+			}
+		}
 
-		// TODO: pass the clip rect so we can skip non-intersecting regions
-		DrawContents(l, dp);
+		if (intersects) {
+			DrawContents(l, dp);
+		} else {
+			ContentSkipped(l);
+		}
 	}
 }
 
@@ -375,10 +396,10 @@ void ContentContainer::DrawContents(const Layout& contentLayout, Point point)
 
 void ContentContainer::AppendContent(Content* content)
 {
-	if (contents.empty())
-		InsertContentAfter(content, NULL);
-	else
-		InsertContentAfter(content, *(--contents.end()));
+	// no need to look for the preceding content, it is the last one
+	content->parent = this;
+	contents.push_back(content);
+	LayoutContentsFrom(std::prev(contents.end()));
 }
 
 void ContentContainer::InsertContentAfter(Content* newContent, const Content* existing)
@@ -526,8 +547,9 @@ Region ContentContainer::BoundingBoxForLayout(const LayoutRegions& layoutRgns) c
 
 const ContentContainer::Layout& ContentContainer::LayoutForContent(const Content* c) const
 {
-	ContentLayout::const_iterator it = std::find(layout.begin(), layout.end(), c);
-	if (it != layout.end()) {
+	// search from the back, we are almost always asked about the content we just laid out
+	ContentLayout::const_reverse_iterator it = std::find(layout.rbegin(), layout.rend(), c);
+	if (it != layout.rend()) {
 		return *it;
 	}
 	static Layout NullLayout(nullptr, LayoutRegions());
@@ -568,7 +590,11 @@ void ContentContainer::LayoutContentsFrom(ContentList::const_iterator it)
 	}
 
 	// clear the existing layout, but only for "it" and onward
+	// if the last layout is for the content preceding "it", there is nothing to clear (appending)
 	ContentList::const_iterator clearit = it;
+	if (!layout.empty() && exContent && layout.back().content == exContent) {
+		clearit = contents.end();
+	}
 	for (; clearit != contents.end(); ++clearit) {
 		ContentLayout::iterator i = std::find(layout.begin(), layout.end(), *clearit);
 		if (i != layout.end()) {
@@ -644,15 +670,17 @@ void ContentContainer::DeleteContentsInRect(const Region& exclusion)
 {
 	int top = exclusion.y;
 	int bottom = top;
-	const Content* content;
+	Point lastPoint = layoutPoint;
 	while (const Region* rgn = ContentRegionForRect(exclusion)) {
-		content = ContentAtPoint(rgn->origin);
-		assert(content);
+		const Layout* contentLayout = LayoutAtPoint(rgn->origin);
+		assert(contentLayout);
 
-		top = (rgn->y < top) ? rgn->y : top;
-		bottom = (rgn->y + rgn->h > bottom) ? rgn->y + rgn->h : bottom;
+		// the whole content goes, not just the region in the rect
+		Region bounds = BoundingBoxForLayout(contentLayout->regions);
+		top = (bounds.y < top) ? bounds.y : top;
+		bottom = (bounds.y + bounds.h > bottom) ? bounds.y + bounds.h : bottom;
 		// must delete content last!
-		delete RemoveContent(content, false);
+		delete RemoveContent(contentLayout->content, false);
 	}
 
 	if (Flags()&RESIZE_HEIGHT) {
@@ -661,10 +689,47 @@ void ContentContainer::DeleteContentsInRect(const Region& exclusion)
 	if (Flags()&RESIZE_WIDTH) {
 		frame.w = 0;
 	}
-	// TODO: we could optimize this to only layout content after exclusion.y
+
+	// trimming the top of a log is the common case: if what remains started on a fresh line
+	// it would be laid out exactly the same, just higher up, so move it instead of redoing it
+	auto firstPlaced = std::find_if(layout.begin(), layout.end(), [](const Layout& l) {
+		return !l.regions.empty();
+	});
+	if (top <= 0 && firstPlaced != layout.end()) {
+		const Region& first = firstPlaced->regions.front()->region;
+		if (first.x == 0 && first.y == bottom) {
+			ShiftLayout(bottom);
+			layoutPoint = lastPoint - Point(0, bottom);
+			return;
+		}
+	}
+
 	LayoutContentsFrom(contents.begin());
 }
 
+void ContentContainer::ShiftLayout(int dy)
+{
+	Size contentBounds = Dimensions();
+	for (Layout& l : layout) {
+		for (auto& lrgn : l.regions) {
+			Region& r = lrgn->region;
+			r.y -= dy;
+			if (Flags()&RESIZE_HEIGHT) {
+				contentBounds.h = std::max(contentBounds.h, r.y + r.h + margin.top + margin.bottom);
+			}
+			if (Flags()&RESIZE_WIDTH) {
+				contentBounds.w = std::max(contentBounds.w, r.x + r.w + margin.left + margin.right);
+			}
+		}
+	}
+
+	// same as at the end of LayoutContentsFrom
+	Size oldSize = Dimensions();
+	frame.w = contentBounds.w;
+	frame.h = contentBounds.h;
+	ResizeSubviews(oldSize);
+}
+
 
 TextContainer::TextContainer(const Region& frame, Font* fnt)
 	: ContentContainer(frame), font(fnt)
@@ -795,6 +860,11 @@ void TextContainer::DrawContents(const Layout& layout, Point dp)
 	printPos += textLength;
 }
 
+void TextContainer::ContentSkipped(const Layout& layout)
+{
+	printPos += static_cast<const TextSpan*>(layout.content)->Text().length();
+}
+
 void TextContainer::SizeChanged(const Size& oldSize)
 {
 	ContentContainer::SizeChanged(oldSize);
@@ -220,6 +220,8 @@ protected:
 	void LayoutContentsFrom(ContentList::const_iterator);
 	void LayoutContentsFrom(const Content*);
 	Content* RemoveContent(const Content* content, bool doLayout);
+	// move all laid out content up by dy, for when the content above it was removed
+	void ShiftLayout(int dy);
 	ContentList::iterator EraseContent(ContentList::iterator it);
 	ContentList::iterator EraseContent(ContentList::iterator beg, ContentList::iterator end);
 
@@ -233,6 +235,8 @@ protected:
 
 private:
 	virtual void ContentRemoved(const Content* /*content*/) {};
+	// called instead of DrawContents for content outside the clip
+	virtual void ContentSkipped(const Layout& /*contentLayout*/) {};
 	
 	void WillDraw(const Region& /*drawFrame*/, const Region& /*clip*/) override;
 	void DidDraw(const Region& /*drawFrame*/, const Region& /*clip*/) override;
@@ -262,6 +266,7 @@ private:
 
 	void DrawSelf(const Region& drawFrame, const Region& clip) override;
 	void DrawContents(const Layout& layout, Point point) override;
+	void ContentSkipped(const Layout& layout) override;
 
 	virtual bool Editable() const { return IsReceivingEvents(); }
 	void SizeChanged(const Size& oldSize) override;
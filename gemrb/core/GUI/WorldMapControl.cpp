@@ -25,6 +25,7 @@
 #include "DisplayMessage.h"
 #include "Game.h"
 #include "Interface.h"
+#include "Settings.h"
 #include "WorldMap.h"
 #include "GUI/EventMgr.h"
 #include "GUI/TextSystem/Font.h"
@@ -304,8 +305,7 @@ bool WorldMapControl::OnMouseWheelScroll(const Point& delta)
 
 bool WorldMapControl::OnKeyPress(const KeyboardEvent& Key, unsigned short /*Mod*/)
 {
-	ieDword keyScrollSpd = 64;
-	core->GetDictionary()->Lookup("Keyboard Scroll Speed", keyScrollSpd);
+	int keyScrollSpd = Settings::KeyboardScrollSpeed;
 	switch (Key.keycode) {
 		case GEM_LEFT:
 			OnMouseWheelScroll(Point(keyScrollSpd * -1, 0));
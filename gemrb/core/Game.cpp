@@ -2212,9 +2212,13 @@ std::string Game::dump() const
 
 Actor *Game::GetActorByGlobalID(ieDword globalID) const
 {
-	for (const auto& map : Maps) {
-		Actor *actor = map->GetActorByGlobalID(globalID);
-		if (actor) return actor;
+	const Scriptable *scr = Scriptable::GetByGlobalID(globalID);
+	if (!scr || scr->Type != ST_ACTOR) {
+		return NULL;
+	}
+	const Actor *actor = static_cast<const Actor*>(scr);
+	if (actor->listedIn && std::find(Maps.begin(), Maps.end(), actor->listedIn) != Maps.end()) {
+		return actor->listedIn->GetActorByGlobalID(globalID);
 	}
 	return GetGlobalActorByGlobalID(globalID);
 }
@@ -26,6 +26,8 @@
 #include "AnimationMgr.h"
 #include "Cache.h"
 #include "CharAnimations.h"
+#include "Dialog.h"
+#include "DialogMgr.h"
 #include "Effect.h"
 #include "EffectMgr.h"
 #include "Factory.h"
@@ -45,6 +47,7 @@
 #include "Scriptable/Actor.h"
 #include "Streams/FileStream.h"
 
+#include <algorithm>
 #include <cstdio>
 
 namespace GemRB {
@@ -82,6 +85,8 @@ void GameData::ClearCaches()
 	SpellCache.RemoveAll(ReleaseSpell);
 	EffectCache.RemoveAll(ReleaseEffect);
 	PaletteCache.clear ();
+	DialogCache.clear();
+	prefetchQueue.clear();
 
 	while (!stores.empty()) {
 		Store *store = stores.begin()->second;
@@ -426,6 +431,54 @@ void GameData::AddFactoryResource(FactoryObject* res)
 	factory->AddFactoryObject(res);
 }
 
+void GameData::PrefetchFactoryResource(const ResRef& resName, SClass_ID type)
+{
+	// keep the backlog short, so we don't load things long after they were needed
+	static const size_t maxPrefetch = 64;
+	if (resName.IsEmpty() || prefetchQueue.size() >= maxPrefetch) return;
+	if (factory->IsLoaded(resName, type) != -1) return;
+
+	auto entry = std::make_pair(resName, type);
+	if (std::find(prefetchQueue.begin(), prefetchQueue.end(), entry) != prefetchQueue.end()) return;
+	prefetchQueue.push_back(entry);
+}
+
+void GameData::LoadPrefetched()
+{
+	if (prefetchQueue.empty()) return;
+
+	auto entry = prefetchQueue.front();
+	prefetchQueue.pop_front();
+	// a guessed resource may well not exist
+	GetFactoryResource(entry.first, entry.second, true);
+}
+
+std::shared_ptr<Dialog> GameData::GetDialog(const ResRef& resRef)
+{
+	// overrides may have changed, so the compiled programs could be stale
+	if (dialogGeneration != IndexGeneration()) {
+		DialogCache.clear();
+		dialogGeneration = IndexGeneration();
+	}
+
+	auto it = DialogCache.find(resRef);
+	if (it != DialogCache.end()) {
+		return it->second;
+	}
+
+	PluginHolder<DialogMgr> dm = GetImporter<DialogMgr>(IE_DLG_CLASS_ID, GetResource(resRef, IE_DLG_CLASS_ID));
+	if (!dm) {
+		return nullptr;
+	}
+	std::shared_ptr<Dialog> dlg(dm->GetDialog());
+	if (!dlg) {
+		return nullptr;
+	}
+	dlg->resRef = resRef;
+	DialogCache.emplace(resRef, dlg);
+	return dlg;
+}
+
 Store* GameData::GetStore(const ResRef &resRef)
 {
 	StoreMap::iterator it = stores.find(resRef);
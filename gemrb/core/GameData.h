@@ -33,7 +33,9 @@
 #include "ResourceManager.h"
 #include "TableMgr.h"
 
+#include <deque>
 #include <map>
+#include <memory>
 #include <unordered_map>
 #include <vector>
 
@@ -42,6 +44,7 @@ namespace GemRB {
 static const ResRef SevenEyes[7]={"spin126","spin127","spin128","spin129","spin130","spin131","spin132"};
 
 class Actor;
+class Dialog;
 struct Effect;
 class Factory;
 class FactoryObject;
@@ -135,6 +138,14 @@ public:
 	FactoryObject* GetFactoryResource(const ResRef& resName, SClass_ID type, bool silent = false);
 
 	void AddFactoryResource(FactoryObject* res);
+	/** queues a factory resource to be loaded ahead of its first use */
+	void PrefetchFactoryResource(const ResRef& resName, SClass_ID type);
+	/** loads one queued resource, called once per frame */
+	void LoadPrefetched();
+
+	/** Returns the compiled dialog, shared by all speakers. Dialogs are
+	 * compiled once and only recompiled after the resource index changes */
+	std::shared_ptr<Dialog> GetDialog(const ResRef& resRef);
 
 	Store* GetStore(const ResRef &resRef);
 	/// Saves a store to the cache and frees it.
@@ -186,7 +197,10 @@ private:
 	Cache SpellCache;
 	Cache EffectCache;
 	ResRefMap<PaletteHolder> PaletteCache;
+	ResRefMap<std::shared_ptr<Dialog>> DialogCache;
+	unsigned int dialogGeneration = 0;
 	Factory* factory;
+	std::deque<std::pair<ResRef, SClass_ID>> prefetchQueue;
 	ResRefMap<AutoTable> tables;
 	using StoreMap = std::map<ResRef, Store*>;
 	StoreMap stores;
@@ -5060,7 +5060,7 @@ void GameScript::ForceAttack( Scriptable* Sender, Action* parameters)
 			scr->AddAction(GenerateActionDirect("NIDSpecial3()", static_cast<Actor*>(tar)));
 		}
 	} else {
-		scr->AddAction(GenerateAction(fmt::format("BashDoor({})", tar->GetScriptName())));
+		scr->AddAction(MakeAction(ActionID::BashDoor).Named(tar->GetScriptName()));
 	}
 }
 
@@ -5544,7 +5544,7 @@ void GameScript::ForceUseContainer(Scriptable* Sender, Action* parameters)
 		Sender->ReleaseCurrentAction(); //why blocking???
 		return;
 	}
-	Action *newaction = GenerateAction("UseContainer()");
+	Action *newaction = MakeAction(ActionID::UseContainer);
 	tar->AddActionInFront(newaction);
 	Sender->ReleaseCurrentAction(); //why blocking???
 }
@@ -6680,8 +6680,7 @@ void GameScript::Leader(Scriptable* Sender, Action* parameters)
 		return;
 	}
 
-	std::string tmp = fmt::format("MoveToPoint([{}.{}])", parameters->pointParameter.x, parameters->pointParameter.y);
-	Action *newact = GenerateAction(std::move(tmp));
+	Action *newact = MakeAction(ActionID::MoveToPoint).At(parameters->pointParameter);
 	Sender->AddAction(newact);
 }
 
@@ -6692,8 +6691,7 @@ void GameScript::Follow(Scriptable* Sender, Action* parameters)
 		return;
 	}
 
-	std::string tmp = fmt::format("MoveToPointNoRecticle([{}.{}])", parameters->pointParameter.x, parameters->pointParameter.y);
-	Action *newact = GenerateAction(std::move(tmp));
+	Action *newact = MakeAction(ActionID::MoveToPointNoRecticle).At(parameters->pointParameter);
 	Sender->AddAction(newact);
 }
 
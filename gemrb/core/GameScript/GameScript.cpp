@@ -2549,6 +2549,105 @@ Action* GenerateAction(std::string actionString)
 	return action;
 }
 
+// must match the order of ActionID
+static const char* const engineActionNames[] = {
+	"addwaypoint(", "attackreevaluate(", "bashdoor(", "berserk(", "breakinstants(",
+	"dialogue(", "interact(", "joinparty(", "leaveparty(", "movetopoint(", "movetopointnorecticle(",
+	"nidspecial2(", "nidspecial9(", "randomturn(", "randomwalk(", "runtopoint(",
+	"setinterrupt(", "triggerwalkto(", "usecontainer("
+};
+static_assert(sizeof(engineActionNames) / sizeof(engineActionNames[0]) == size_t(ActionID::count), "ActionID and engineActionNames are out of sync");
+// 0 (NoAction) means not looked up yet
+static int engineActionIDs[size_t(ActionID::count)];
+
+static int ResolveEngineAction(ActionID id)
+{
+	int& actionID = engineActionIDs[size_t(id)];
+	if (actionID > 0) {
+		return actionID;
+	}
+
+	StringView key(engineActionNames[size_t(id)]);
+	int i = -1;
+	if (overrideActionsTable) {
+		i = overrideActionsTable->FindString(key);
+		if (i >= 0) {
+			actionID = overrideActionsTable->GetValueIndex(i);
+		}
+	}
+	if (i < 0) {
+		i = actionsTable->FindString(key);
+		if (i < 0) {
+			Log(ERROR, "GameScript", "Invalid scripting action: {}", key);
+			return -1;
+		}
+		actionID = actionsTable->GetValueIndex(i);
+	}
+	return actionID;
+}
+
+ActionBuilder::ActionBuilder(ActionID id)
+{
+	int actionID = ResolveEngineAction(id);
+	if (actionID < 0) {
+		return;
+	}
+
+	action = new Action(true);
+	action->actionID = static_cast<unsigned short>(actionID);
+	// same object slots as in GenerateActionCore
+	objectCount = (actionID == 1) ? 0 : 1;
+	if (actionflags[actionID] & AF_DIRECT) {
+		NextObject()->objectFields[0] = -1;
+	}
+}
+
+Object* ActionBuilder::NextObject()
+{
+	assert(objectCount < 3);
+	Object* object = new Object();
+	action->objects[objectCount++] = object;
+	return object;
+}
+
+ActionBuilder& ActionBuilder::Int(int value)
+{
+	if (!action) return *this;
+
+	if (!intCount) {
+		action->int0Parameter = value;
+	} else if (intCount == 1) {
+		action->int1Parameter = value;
+	} else {
+		action->int2Parameter = value;
+	}
+	intCount++;
+	return *this;
+}
+
+ActionBuilder& ActionBuilder::At(const Point& p)
+{
+	if (action) action->pointParameter = p;
+	return *this;
+}
+
+ActionBuilder& ActionBuilder::EA(int ea)
+{
+	// the first object field is the EA in all games
+	if (action) NextObject()->objectFields[0] = ea;
+	return *this;
+}
+
+ActionBuilder& ActionBuilder::Named(const ieVariable& scriptName)
+{
+	if (!action) return *this;
+
+	Object* object = NextObject();
+	object->objectName = scriptName;
+	StringToLower(object->objectName);
+	return *this;
+}
+
 Action *GenerateActionDirect(std::string string, const Scriptable *object)
 {
 	Action* action = GenerateAction(std::move(string));
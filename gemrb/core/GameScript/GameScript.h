@@ -1556,6 +1556,58 @@ public: //Script Functions
 
 GEM_EXPORT Action* GenerateAction(std::string String);
 Action *GenerateActionDirect(std::string string, const Scriptable *object);
+
+/** Actions the engine queues by itself; their ids differ between the games,
+ * so they are looked up by name (once) */
+enum class ActionID : uint8_t {
+	AddWayPoint,
+	AttackReevaluate,
+	BashDoor,
+	Berserk,
+	BreakInstants,
+	Dialogue,
+	Interact,
+	JoinParty,
+	LeaveParty,
+	MoveToPoint,
+	MoveToPointNoRecticle,
+	NIDSpecial2,
+	NIDSpecial9,
+	RandomTurn,
+	RandomWalk,
+	RunToPoint,
+	SetInterrupt,
+	TriggerWalkTo,
+	UseContainer,
+	count
+};
+
+/** Builds an action directly, without formatting and parsing script text.
+ * Parameters are filled in the order of the action's prototype, just like
+ * GenerateAction does it, eg. MakeAction(ActionID::MoveToPoint).At(p) */
+class GEM_EXPORT ActionBuilder {
+public:
+	explicit ActionBuilder(ActionID id);
+
+	ActionBuilder& Int(int value);
+	ActionBuilder& At(const Point& p);
+	/** an object parameter matching the given EA, eg. [PC] */
+	ActionBuilder& EA(int ea);
+	/** an object parameter matching the given script name */
+	ActionBuilder& Named(const ieVariable& scriptName);
+
+	/** NULL if the action doesn't exist in this game */
+	operator Action*() const { return action; }
+
+private:
+	Action* action = nullptr;
+	int intCount = 0;
+	int objectCount = 0;
+
+	Object* NextObject();
+};
+
+inline ActionBuilder MakeAction(ActionID id) { return ActionBuilder(id); }
 GEM_EXPORT Trigger* GenerateTrigger(std::string string);
 
 void InitializeIEScript();
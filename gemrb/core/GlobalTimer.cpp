@@ -32,7 +32,8 @@ void GlobalTimer::Freeze()
 {
 	tick_t thisTime = GetMilliseconds();
 
-	if (UpdateViewport(thisTime) == false) {
+	dueTicks = 0;
+	if (!UpdateViewport(thisTime)) {
 		return;
 	}
 
@@ -113,18 +114,28 @@ void GlobalTimer::DoStep(int count)
 	currentVP = gc->Viewport();
 }
 
-bool GlobalTimer::UpdateViewport(tick_t thisTime)
+// how many ticks we run in a row to catch up with the clock
+static const ieDword MAX_CATCHUP_TICKS = 5;
+
+// length of a tick in ms
+static tick_t TickInterval()
+{
+	static tick_t interval = core ? core->Time.Ticks2Ms(1) : 66;
+	return interval;
+}
+
+ieDword GlobalTimer::UpdateViewport(tick_t thisTime)
 {
 	tick_t advance = thisTime - startTime;
-	static tick_t interval = core ? core->Time.Ticks2Ms(1) : 66; // length of a tick in ms
+	tick_t interval = TickInterval();
 	if ( advance < interval) {
-		return false;
+		return 0;
 	}
 
 	ieDword count = ieDword(advance/interval);
 	DoStep(count);
 	DoFadeStep(count);
-	return true;
+	return count;
 }
 
 bool GlobalTimer::Update()
@@ -143,9 +154,22 @@ bool GlobalTimer::Update()
 		goto end;
 	}
 
-	if (UpdateViewport(thisTime) == false) {
-		return false;
+	if (!dueTicks) {
+		ieDword count = UpdateViewport(thisTime);
+		if (!count) {
+			return false;
+		}
+		// keep the remainder, so the game runs at the same rate with any frame rate
+		// if we fell too far behind (a hitch or a long load), just drop the backlog
+		if (count > MAX_CATCHUP_TICKS) {
+			dueTicks = 1;
+			startTime = thisTime;
+		} else {
+			dueTicks = count;
+			startTime += count * TickInterval();
+		}
 	}
+	dueTicks--;
 
 	game = core->GetGame();
 	if (!game) {
@@ -160,6 +184,7 @@ bool GlobalTimer::Update()
 	if (!(gc->GetDialogueFlags()&DF_IN_DIALOG) ) {
 		map->UpdateFog();
 		map->UpdateEffects();
+		map->UpdateProjectiles();
 		if (thisTime) {
 			//this measures in-world time (affected by effects, actions, etc)
 			game->AdvanceTime(1);
@@ -169,11 +194,18 @@ bool GlobalTimer::Update()
 	if (thisTime) {
 		game->RealTime++;
 	}
+	return true;
 end:
+	dueTicks = 0;
 	startTime = thisTime;
 	return true;
 }
 
+bool GlobalTimer::TicksPending() const
+{
+	return dueTicks > 0;
+}
+
 
 void GlobalTimer::DoFadeStep(ieDword count) {
 	WindowManager* wm = core->GetWindowManager();
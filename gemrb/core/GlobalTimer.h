@@ -30,6 +30,8 @@ namespace GemRB {
 class GEM_EXPORT GlobalTimer {
 private:
 	tick_t startTime = 0; //forcing an update;
+	// ticks that are due, but weren't run yet (see Interface::GameLoop)
+	ieDword dueTicks = 0;
 
 	tick_t fadeToCounter = 0;
 	tick_t fadeToMax = 0;
@@ -45,7 +47,7 @@ private:
 	Region currentVP;
 
 	void DoFadeStep(ieDword count);
-	bool UpdateViewport(tick_t time);
+	ieDword UpdateViewport(tick_t time);
 public:
 	GlobalTimer() noexcept = default;
 	
@@ -54,6 +56,7 @@ public:
 
 	void Freeze();
 	bool Update();
+	bool TicksPending() const;
 	bool ViewportIsMoving() const;
 	void DoStep(int count);
 	void SetMoveViewPort(Point p, int spd, bool center);
@@ -32,7 +32,6 @@
 #include "Calendar.h"
 #include "DataFileMgr.h"
 #include "DialogHandler.h"
-#include "DialogMgr.h"
 #include "DisplayMessage.h"
 #include "EffectMgr.h"
 #include "EffectQueue.h"
@@ -76,6 +75,7 @@
 #include "RNG.h"
 #include "Scriptable/Container.h"
 #include "Streams/FileStream.h"
+#include "Streams/MemoryStream.h"
 #include "System/FileFilters.h"
 
 #include <utility>
@@ -641,6 +641,8 @@ void Interface::Main()
 		}
 
 		GameLoop();
+		gamedata->LoadPrefetched();
+		sgiterator->PollSaveWriter();
 		// TODO: find other animations that need to be synchronized
 		// we can create a manager for them and everything can be updated at once
 		GlobalColorCycle.AdvanceTime(time);
@@ -786,6 +788,7 @@ int Interface::LoadFonts()
 int Interface::Init(const InterfaceConfig* cfg)
 {
 	Log(MESSAGE, "Core", "GemRB core version v" VERSION_GEMRB " loading ...");
+	tick_t initStart = GetMilliseconds();
 	if (!cfg) {
 		Log(FATAL, "Core", "No Configuration context.");
 		return GEM_ERROR;
@@ -1432,7 +1435,7 @@ int Interface::Init(const InterfaceConfig* cfg)
 		Log(WARNING, "Core", "Failed to initialize keymaps.");
 	}
 
-	Log(MESSAGE, "Core", "Core Initialization Complete!");
+	Log(MESSAGE, "Core", "Core Initialization Complete! ({} ms)", GetMilliseconds() - initStart);
 
 #ifdef HAVE_REALPATH
 	if (unhardcodedTypePath[0] == '.') {
@@ -2101,9 +2104,16 @@ void Interface::GameLoop(void)
 			gc->ChangeMap(GetFirstSelectedPC(true), false);
 		}
 		//in multi player (if we ever get to it), only the server must call this
-		if (do_update) {
+		// the game runs at a fixed tick rate, so run all the ticks that became
+		// due since the last frame, no matter how long drawing it took
+		while (do_update && game) {
 			// the game object will run the area scripts as well
 			game->UpdateScripts();
+			if (!timer.TicksPending()) {
+				break;
+			}
+			update_scripts = !(gc && (gc->GetDialogueFlags() & DF_FREEZE_SCRIPTS));
+			do_update = GSUpdate(update_scripts);
 		}
 	}
 }
@@ -3247,6 +3257,7 @@ void Interface::RemoveFromCache(const ResRef& resref, SClass_ID ClassID) const
 
 	PathJoinExt(filename, config.CachePath, resref.c_str(), TypeExt(ClassID));
 	unlink ( filename);
+	ResourceManager::ForgetResource(filename);
 }
 
 //this function checks if the path is eligible as a cache
@@ -3311,6 +3322,7 @@ void Interface::DelTree(const char* Pt, bool onlysave) const
 			unlink( dtmp );
 		}
 	} while (++dir);
+	ResourceManager::InvalidateIndex();
 }
 
 void Interface::LoadProgress(int percent)
@@ -3658,8 +3670,7 @@ int Interface::GetMouseScrollSpeed() const {
 
 ieStrRef Interface::GetRumour(const ResRef& dlgref)
 {
-	PluginHolder<DialogMgr> dm = GetImporter<DialogMgr>(IE_DLG_CLASS_ID, gamedata->GetResource(dlgref, IE_DLG_CLASS_ID));
-	Dialog *dlg = dm->GetDialog();
+	std::shared_ptr<Dialog> dlg = gamedata->GetDialog(dlgref);
 
 	if (!dlg) {
 		Log(ERROR, "Interface", "Cannot load dialog: {}", dlgref);
@@ -3675,7 +3686,6 @@ ieStrRef Interface::GetRumour(const ResRef& dlgref)
 	if (i>=0 ) {
 		ret = dlg->GetState( i )->StrRef;
 	}
-	delete dlg;
 	return ret;
 }
 
@@ -3987,25 +3997,12 @@ static bool IsBlobSaveItem(const char *path) {
 	return areExt != nullptr && path + pathLength - 4 == areExt;
 }
 
-int Interface::CompressSave(const char *folder, bool overrideRunning)
+int Interface::ForEachSaveItem(const std::function<int(const char*, DataStream&)>& add) const
 {
-	FileStream str;
-
-	str.Create(folder, GameNameResRef.c_str(), IE_SAV_CLASS_ID);
 	DirectoryIterator dir(config.CachePath);
 	if (!dir) {
 		return GEM_ERROR;
 	}
-	PluginHolder<ArchiveImporter> ai = MakePluginHolder<ArchiveImporter>(IE_SAV_CLASS_ID);
-	ai->CreateArchive( &str);
-
-	tick_t startTime = GetMilliseconds();
-	// If we override the savegame we are running to fetch AREs from, it has already dumped
-	// itself as "ares.blb" into the cache folder. Otherwise, just copy directly.
-	if (!overrideRunning && saveGameAREExtractor.copyRetainedAREs(&str) == GEM_ERROR) {
-		Log(ERROR, "Interface", "Failed to copy ARE files into new save game.");
-		return GEM_ERROR;
-	}
 
 	dir.SetFlags(DirectoryIterator::Files);
 	//.tot and .toh should be saved last, because they are updated when an .are is saved
@@ -4019,15 +4016,10 @@ int Interface::CompressSave(const char *folder, bool overrideRunning)
 				FileStream fs;
 				if (!fs.Open(dtmp)) {
 					Log(ERROR, "Interface", "Failed to open \"{}\".", dtmp);
+					return GEM_ERROR;
 				}
-
-				if (IsBlobSaveItem(dtmp)) {
-					if (overrideRunning) {
-						saveGameAREExtractor.updateSaveGame(str.GetPos());
-						ai->AddToSaveGameCompressed(&str, &fs);
-					}
-				} else {
-					ai->AddToSaveGame(&str, &fs);
+				if (add(dtmp, fs) != GEM_OK) {
+					return GEM_ERROR;
 				}
 			}
 		} while (++dir);
@@ -4037,12 +4029,105 @@ int Interface::CompressSave(const char *folder, bool overrideRunning)
 			dir.Rewind();
 		}
 	}
+	return GEM_OK;
+}
+
+int Interface::CompressSave(const char *folder, bool overrideRunning)
+{
+	FileStream str;
+
+	str.Create(folder, GameNameResRef.c_str(), IE_SAV_CLASS_ID);
+	PluginHolder<ArchiveImporter> ai = MakePluginHolder<ArchiveImporter>(IE_SAV_CLASS_ID);
+	ai->CreateArchive( &str);
+
+	tick_t startTime = GetMilliseconds();
+	// If we override the savegame we are running to fetch AREs from, it has already dumped
+	// itself as "ares.blb" into the cache folder. Otherwise, just copy directly.
+	if (!overrideRunning && saveGameAREExtractor.copyRetainedAREs(&str) == GEM_ERROR) {
+		Log(ERROR, "Interface", "Failed to copy ARE files into new save game.");
+		return GEM_ERROR;
+	}
+
+	int ret = ForEachSaveItem([&](const char* path, DataStream& fs) {
+		if (!IsBlobSaveItem(path)) {
+			return ai->AddToSaveGame(&str, &fs);
+		}
+		if (overrideRunning) {
+			saveGameAREExtractor.updateSaveGame(str.GetPos());
+			return ai->AddToSaveGameCompressed(&str, &fs);
+		}
+		return GEM_OK;
+	});
+	if (ret != GEM_OK) {
+		Log(ERROR, "Interface", "Failed to write save game archive in {}.", folder);
+		return GEM_ERROR;
+	}
 
 	tick_t endTime = GetMilliseconds();
 	Log(WARNING, "Core", "{} ms (compressing SAV file)", endTime - startTime);
 	return GEM_OK;
 }
 
+std::function<int()> Interface::CompressSaveLater(const char *folder)
+{
+	auto str = std::make_shared<FileStream>();
+	if (!str->Create(folder, GameNameResRef.c_str(), IE_SAV_CLASS_ID)) {
+		return nullptr;
+	}
+	PluginHolder<ArchiveImporter> ai = MakePluginHolder<ArchiveImporter>(IE_SAV_CLASS_ID);
+	ai->CreateArchive(str.get());
+
+	// the retained areas are already compressed, so copying them is quick
+	if (saveGameAREExtractor.copyRetainedAREs(str.get()) == GEM_ERROR) {
+		Log(ERROR, "Interface", "Failed to copy ARE files into new save game.");
+		return nullptr;
+	}
+
+	// the cache keeps changing once the game goes on, so take the files now
+	std::vector<std::shared_ptr<DataStream>> files;
+	int ret = ForEachSaveItem([&](const char* path, DataStream& fs) {
+		if (IsBlobSaveItem(path)) {
+			return GEM_OK;
+		}
+		strpos_t size = fs.Size();
+		void* data = malloc(size);
+		if (size && (!data || fs.Read(data, size) != strret_t(size))) {
+			Log(ERROR, "Interface", "Failed to read \"{}\".", path);
+			free(data);
+			return GEM_ERROR;
+		}
+		files.push_back(std::make_shared<MemoryStream>(path, data, size));
+		return GEM_OK;
+	});
+	if (ret != GEM_OK) {
+		return nullptr;
+	}
+
+	std::string path = str->originalfile;
+	return [str, ai, files, path]() {
+		tick_t startTime = GetMilliseconds();
+		int ret = GEM_OK;
+		for (const auto& file : files) {
+			if (ai->AddToSaveGame(str.get(), file.get()) != GEM_OK) {
+				ret = GEM_ERROR;
+				break;
+			}
+		}
+		// a failed flush would leave the archive short too
+		if (!str->Close()) {
+			ret = GEM_ERROR;
+		}
+		if (ret != GEM_OK) {
+			Log(ERROR, "Interface", "Failed to write save game archive {}.", path);
+			return ret;
+		}
+
+		tick_t endTime = GetMilliseconds();
+		Log(WARNING, "Core", "{} ms (compressing SAV file)", endTime - startTime);
+		return ret;
+	};
+}
+
 int Interface::GetRareSelectSoundCount() const { return NumRareSelectSounds; }
 
 int Interface::GetMaximumAbility() const { return MaximumAbility; }
@@ -48,6 +48,7 @@
 #include "StringMgr.h"
 #include "System/VFS.h"
 
+#include <functional>
 #include <map>
 #include <string>
 #include <vector>
@@ -681,6 +682,9 @@ public:
 	int WriteWorldMap(const char *folder);
 	/** saves the .are and .sto files to the destination folder */
 	int CompressSave(const char *folder, bool overrideRunning);
+	/** like CompressSave, but only reads the cache files into memory, the returned
+	 * job compresses them into the archive and may run on another thread */
+	std::function<int()> CompressSaveLater(const char *folder);
 	/** toggles the pause. returns either PAUSE_ON or PAUSE_OFF to reflect the script state after toggling. */
 	PauseSetting TogglePause() const;
 	/** returns true the passed pause setting was applied. false otherwise. */
@@ -757,6 +761,8 @@ private:
 	GameControl* StartGameControl();
 	/** Executes everything (non graphical) in the main game loop */
 	void GameLoop(void);
+	/** opens the cache files that go into a save, in save order, and passes them to add */
+	int ForEachSaveItem(const std::function<int(const char*, DataStream&)>& add) const;
 	/** the internal (without cache) part of GetListFrom2DA */
 	std::vector<ieDword>* GetListFrom2DAInternal(const ResRef& resref);
 
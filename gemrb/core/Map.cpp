@@ -38,6 +38,7 @@
 #include "Projectile.h"
 #include "SaveGameIterator.h"
 #include "ScriptedAnimation.h"
+#include "Settings.h"
 #include "TileMap.h"
 #include "VEFObject.h"
 #include "Video/Video.h"
@@ -51,6 +52,7 @@
 #include "Scriptable/Door.h"
 #include "Scriptable/InfoPoint.h"
 
+#include <algorithm>
 #include <array>
 #include <cassert>
 #include <limits>
@@ -313,7 +315,6 @@ private:
 static const ResRef PortalResRef = "EF03TPR3";
 static unsigned int PortalTime = 15;
 
-static ieDword oldGameTime = 0;
 
 static inline AnimationObjectType SelectObject(const Actor *actor, int q, const AreaAnimation *a, const VEFObject *sca, const Particles *spark, const Projectile *pro, const Container *pile)
 {
@@ -422,6 +423,8 @@ Map::~Map(void)
 		//don't delete NPC/PC
 		if (actor && !actor->Persistent()) {
 			delete actor;
+		} else if (actor && actor->listedIn == this) {
+			actor->listedIn = nullptr;
 		}
 	}
 
@@ -924,6 +927,58 @@ bool Map::FogTileUncovered(const Point &p, const Bitmap* mask) const
 }
 
 void Map::DrawFogOfWar(const Bitmap* explored_mask, const Bitmap* visible_mask, const Region& vp) const
+{
+	Video* vid = core->GetVideoDriver();
+	if (!vid->BlendsIntoAlphaBuffers()) {
+		// the edge sprites would come out opaque in the buffer
+		fogCache.buffer = nullptr;
+		RenderFogOfWar(explored_mask, visible_mask, vp);
+		return;
+	}
+
+	// only the fog cells under the viewport matter, so vision changing
+	// elsewhere on the map doesn't force a redraw
+	const Size fogSize = FogMapSize();
+	const int largefog = Explore::Get().LargeFog;
+	const Point start = Clamp(ConvertPointToFog(vp.origin), Point(), Point(fogSize.w, fogSize.h));
+	const Point end = Clamp(ConvertPointToFog(vp.Maximum()) + Point(2 + largefog, 2 + largefog), Point(), Point(fogSize.w, fogSize.h));
+	std::vector<uint8_t> cells;
+	cells.reserve((end.x - start.x) * (end.y - start.y));
+	for (int y = start.y; y < end.y; ++y) {
+		for (int x = start.x; x < end.x; ++x) {
+			Point p(x, y);
+			cells.push_back(FogTileUncovered(p, explored_mask) | (FogTileUncovered(p, visible_mask) << 1));
+		}
+	}
+
+	bool redraw = fogCache.buffer == nullptr || fogCache.viewport != vp
+		|| fogCache.explored != explored_mask || fogCache.visible != visible_mask
+		|| fogCache.cells != cells;
+
+	if (redraw) {
+		if (fogCache.buffer == nullptr || fogCache.viewport.size != vp.size) {
+			fogCache.buffer = vid->CreateBuffer(Region(Point(), vp.size), Video::BufferFormat::DISPLAY_ALPHA);
+		}
+		fogCache.viewport = vp;
+		fogCache.explored = explored_mask;
+		fogCache.visible = visible_mask;
+		fogCache.cells = std::move(cells);
+
+		// the fog is all black, so blending it into a transparent buffer and
+		// that onto the map gives the same result as drawing it directly
+		Region clip = vid->GetScreenClip();
+		vid->SetScreenClip(nullptr);
+		vid->PushDrawingBuffer(fogCache.buffer);
+		fogCache.buffer->Clear();
+		RenderFogOfWar(explored_mask, visible_mask, vp);
+		vid->PopDrawingBuffer();
+		vid->SetScreenClip(&clip);
+	}
+
+	vid->BlitVideoBuffer(fogCache.buffer, Point(), BlitFlags::BLENDED);
+}
+
+void Map::RenderFogOfWar(const Bitmap* explored_mask, const Bitmap* visible_mask, const Region& vp) const
 {
 	// Size of Fog-Of-War shadow tile (and bitmap)
 	constexpr int CELL_SIZE = 32;
@@ -1425,6 +1480,7 @@ void Map::DrawMap(const Region& viewport, uint32_t dFlags)
 	// TODO: In at least HOW/IWD2 actor ground circles will be hidden by
 	// an area animation with height > 0 even if the actors themselves are not
 	// hidden by it.
+	pickList.clear();
 
 	while (actor || a || sca || spark || pro || pile) {
 		switch(SelectObject(actor,q,a,sca,spark,pro,pile)) {
@@ -1447,6 +1503,7 @@ void Map::DrawMap(const Region& viewport, uint32_t dFlags)
 					Color tint(baseTint);
 					game->ApplyGlobalTint(tint, flags);
 					actor->Draw(viewport, baseTint, tint, flags | BlitFlags::BLENDED);
+					pickList.push_back(actor);
 				}
 			}
 
@@ -1506,34 +1563,13 @@ void Map::DrawMap(const Region& viewport, uint32_t dFlags)
 			sca = GetNextScriptedAnimation(scaidx);
 			break;
 		case AOT_PROJECTILE:
-			int drawn;
-			if (gametime > oldGameTime) {
-				drawn = pro->Update();
-			} else {
-				drawn = 1;
-			}
-			if (drawn) {
-				pro->Draw(viewport);
-				proidx++;
-			} else {
-				delete pro;
-				proidx = projectiles.erase(proidx);
-			}
+			pro->Draw(viewport);
+			proidx++;
 			pro = GetNextProjectile(proidx);
 			break;
 		case AOT_SPARK:
-			if (gametime > oldGameTime) {
-				drawn = spark->Update();
-			} else {
-				drawn = 1;
-			}
-			if (drawn) {
-				spark->Draw(viewport.origin);
-				spaidx++;
-			} else {
-				delete spark;
-				spaidx = particles.erase(spaidx);
-			}
+			spark->Draw(viewport.origin);
+			spaidx++;
 			spark = GetNextSpark(spaidx);
 			break;
 		default:
@@ -1590,11 +1626,12 @@ void Map::DrawMap(const Region& viewport, uint32_t dFlags)
 		actors[i]->DrawOverheadText();
 	}
 
-	oldGameTime = gametime;
-
 	// Show wallpolygons
 	if (debugFlags & (DEBUG_SHOW_WALLS_ALL|DEBUG_SHOW_DOORS_DISABLED)) {
 		const auto& viewportWallsAll = WallsIntersectingRegion(viewport, true);
+		// the baselines are collected and drawn together after the polygons
+		std::vector<Point> baselines;
+		std::vector<Color> baselineColors;
 		for (const auto& poly : viewportWallsAll.first) {
 			const Point& origin = poly->BBox.origin - viewport.origin;
 
@@ -1624,9 +1661,12 @@ void Map::DrawMap(const Region& viewport, uint32_t dFlags)
 			video->DrawPolygon( poly.get(), origin, c, true, BlitFlags::BLENDED|BlitFlags::HALFTRANS);
 			
 			if (poly->wall_flag & WF_BASELINE) {
-				video->DrawLine(poly->base0 - viewport.origin, poly->base1 - viewport.origin, ColorMagenta);
+				baselines.push_back(poly->base0 - viewport.origin);
+				baselines.push_back(poly->base1 - viewport.origin);
+				baselineColors.push_back(ColorMagenta);
 			}
 		}
+		video->DrawLineSegments(baselines, baselineColors);
 	}
 }
 
@@ -1766,11 +1806,8 @@ BlitFlags Map::SetDrawingStencilForScriptable(const Scriptable* scriptable, cons
 		return BlitFlags::NONE; // not behind a wall, no stencil required
 	}
 	
-	ieDword always_dither;
-	core->GetDictionary()->Lookup("Always Dither", always_dither);
-	
 	BlitFlags flags = BlitFlags::STENCIL_DITHER; // TODO: make dithering configurable
-	if (always_dither) {
+	if (Settings::AlwaysDither) {
 		flags |= BlitFlags::STENCIL_ALPHA;
 	} else if (core->DitherSprites == false) {
 		// dithering is set to disabled
@@ -1943,6 +1980,29 @@ void Map::UpdateEffects()
 	}
 }
 
+void Map::UpdateProjectiles()
+{
+	// updating may spawn further projectiles and particles (fragments, sparks),
+	// which is fine since inserting into the lists keeps our iterator valid
+	for (auto it = projectiles.begin(); it != projectiles.end();) {
+		if ((*it)->Update()) {
+			++it;
+		} else {
+			delete *it;
+			it = projectiles.erase(it);
+		}
+	}
+
+	for (auto it = particles.begin(); it != particles.end();) {
+		if ((*it)->Update()) {
+			++it;
+		} else {
+			delete *it;
+			it = particles.erase(it);
+		}
+	}
+}
+
 void Map::Shout(const Actor* actor, int shoutID, bool global) const
 {
 	for (auto listener : actors) {
@@ -2067,6 +2127,7 @@ void Map::AddActor(Actor* actor, bool init)
 	if (!HasActor(actor)) {
 		actors.push_back( actor );
 	}
+	actor->listedIn = this;
 	if (init) {
 		actor->SetMap(this);
 		MarkVisited(actor);
@@ -2105,6 +2166,8 @@ void Map::DeleteActor(int i)
 		actor->SetMap(NULL);
 		actor->Area.Reset();
 		objectStencils.erase(actor);
+		pickList.erase(std::remove(pickList.begin(), pickList.end(), actor), pickList.end());
+		actor->listedIn = nullptr;
 		//don't destroy the object in case it is a persistent object
 		//otherwise there is a dead reference causing a crash on save
 		if (game->InStore(actor) < 0) {
@@ -2118,82 +2181,77 @@ void Map::DeleteActor(int i)
 Scriptable *Map::GetScriptableByGlobalID(ieDword objectID)
 {
 	if (!objectID) return NULL;
-	
-	Scriptable *scr = GetActorByGlobalID(objectID);
-	if (scr)
-		return scr;
-
-	scr = GetInfoPointByGlobalID(objectID);
-	if (scr)
-		return scr;
-
-	scr = GetContainerByGlobalID(objectID);
-	if (scr)
-		return scr;
-
-	scr = GetDoorByGlobalID(objectID);
-	if (scr)
-		return scr;
 
-	if (GetGlobalID() == objectID)
-		scr = this;
-
-	return scr;
+	Scriptable *scr = Scriptable::GetByGlobalID(objectID);
+	if (!scr) return NULL;
+
+	switch (scr->Type) {
+		case ST_ACTOR:
+			return GetActorByGlobalID(objectID);
+		case ST_PROXIMITY:
+		case ST_TRIGGER:
+		case ST_TRAVEL:
+			return GetInfoPointByGlobalID(objectID);
+		case ST_CONTAINER:
+			return GetContainerByGlobalID(objectID);
+		case ST_DOOR:
+			return GetDoorByGlobalID(objectID);
+		case ST_AREA:
+			return scr == this ? scr : NULL;
+		default:
+			return NULL;
+	}
 }
 
+// doors, containers and infopoints never change areas, so the owning map is enough
 Door *Map::GetDoorByGlobalID(ieDword objectID) const
 {
-	if (!objectID) return NULL;
-
-	int doorCount = 0;
-	while (true) {
-		Door* door = TMap->GetDoor( doorCount++ );
-		if (!door)
-			return NULL;
-		if (door->GetGlobalID() == objectID)
-			return door;
+	Scriptable *scr = Scriptable::GetByGlobalID(objectID);
+	if (!scr || scr->Type != ST_DOOR || scr->GetCurrentArea() != this) {
+		return NULL;
 	}
+	return static_cast<Door*>(scr);
 }
 
 Container *Map::GetContainerByGlobalID(ieDword objectID) const
 {
-	if (!objectID) return NULL;
-
-	int containerCount = 0;
-	while (true) {
-		Container* container = TMap->GetContainer( containerCount++ );
-		if (!container)
-			return NULL;
-		if (container->GetGlobalID() == objectID)
-			return container;
+	Scriptable *scr = Scriptable::GetByGlobalID(objectID);
+	if (!scr || scr->Type != ST_CONTAINER || scr->GetCurrentArea() != this) {
+		return NULL;
 	}
+	return static_cast<Container*>(scr);
 }
 
 InfoPoint *Map::GetInfoPointByGlobalID(ieDword objectID) const
 {
-	if (!objectID) return NULL;
-
-	int ipCount = 0;
-	while (true) {
-		InfoPoint* ip = TMap->GetInfoPoint( ipCount++ );
-		if (!ip)
-			return NULL;
-		if (ip->GetGlobalID() == objectID)
-			return ip;
+	Scriptable *scr = Scriptable::GetByGlobalID(objectID);
+	if (!scr || scr->GetCurrentArea() != this) {
+		return NULL;
+	}
+	if (scr->Type != ST_PROXIMITY && scr->Type != ST_TRIGGER && scr->Type != ST_TRAVEL) {
+		return NULL;
 	}
+	return static_cast<InfoPoint*>(scr);
 }
 
 Actor* Map::GetActorByGlobalID(ieDword objectID) const
 {
-	if (!objectID) {
+	Scriptable *scr = Scriptable::GetByGlobalID(objectID);
+	if (!scr || scr->Type != ST_ACTOR) {
 		return nullptr;
 	}
-	for (const auto& actor : actors) {
-		if (actor->GetGlobalID()==objectID) {
-			return actor;
-		}
+	Actor *actor = static_cast<Actor*>(scr);
+	if (actor->listedIn != this) {
+		actor = nullptr;
 	}
-	return nullptr;
+#ifdef _DEBUG
+	// the registry has to agree with the actor list
+	auto it = std::find_if(actors.begin(), actors.end(), [objectID](const Actor *a) {
+		return a->GetGlobalID() == objectID;
+	});
+	assert(actor == (it == actors.end() ? nullptr : *it));
+#endif
+	return actor;
 }
 
 /** flags:
@@ -2215,6 +2273,20 @@ Actor* Map::GetActor(const Point &p, int flags, const Movable *checker) const
 	return NULL;
 }
 
+Actor* Map::PickActor(const Point &p, int flags) const
+{
+	for (auto it = pickList.rbegin(); it != pickList.rend(); ++it) {
+		Actor* actor = *it;
+		if (!actor->IsOver(p))
+			continue;
+		if (!actor->ValidTarget(flags)) {
+			continue;
+		}
+		return actor;
+	}
+	return nullptr;
+}
+
 Actor* Map::GetActorInRadius(const Point &p, int flags, unsigned int radius) const
 {
 	for (auto actor : actors) {
@@ -2488,6 +2560,23 @@ std::vector<Actor*> Map::GetActorsInRect(const Region& rgn, int excludeFlags) co
 	return actorlist;
 }
 
+std::vector<Actor*> Map::PickActorsInRect(const Region& rgn, int excludeFlags) const
+{
+	std::vector<Actor*> actorlist;
+	for (auto it = pickList.rbegin(); it != pickList.rend(); ++it) {
+		Actor* actor = *it;
+		if (!actor->ValidTarget(excludeFlags))
+			continue;
+		if (!rgn.PointInside(actor->Pos)
+			&& !actor->IsOver(rgn.origin)) // imagine drawing a tiny box inside the circle, but not over the center
+			continue;
+
+		actorlist.push_back(actor);
+	}
+
+	return actorlist;
+}
+
 bool Map::SpawnsAlive() const
 {
 	for (const auto& actor : actors) {
@@ -2903,6 +2992,8 @@ void Map::RemoveActor(Actor* actor)
 			ClearSearchMapFor(actor);
 			actor->SetMap(NULL);
 			actor->Area.Reset();
+			actor->listedIn = nullptr;
+			pickList.erase(std::remove(pickList.begin(), pickList.end(), actor), pickList.end());
 			actors.erase( actors.begin()+i );
 			return;
 		}
@@ -3365,6 +3456,7 @@ Size Map::GetSize() const
 void Map::FillExplored(bool explored)
 {
 	ExploredBitmap.fill(explored ? 0xff : 0x00);
+	++exploredGeneration;
 }
 
 void Map::ExploreTile(const Point &p, bool fogOnly)
@@ -3376,7 +3468,10 @@ void Map::ExploreTile(const Point &p, bool fogOnly)
 		return;
 	}
 	
-	ExploredBitmap[fogP] = true;
+	if (!ExploredBitmap.GetAt(fogP, true)) {
+		ExploredBitmap[fogP] = true;
+		++exploredGeneration;
+	}
 	if (!fogOnly) {
 		VisibleBitmap[fogP] = true;
 	}
@@ -3628,9 +3723,7 @@ bool Map::HasWeather() const
 	if ((AreaType & (AT_WEATHER|AT_OUTDOOR) ) != (AT_WEATHER|AT_OUTDOOR) ) {
 		return false;
 	}
-	ieDword tmp = 1;
-	core->GetDictionary()->Lookup("Weather", tmp);
-	return !!tmp;
+	return Settings::Weather;
 }
 
 int Map::GetWeather() const
@@ -438,7 +438,20 @@ private:
 	VideoBufferPtr wallStencil = nullptr;
 	Region stencilViewport;
 
+	unsigned int exploredGeneration = 0;
+	// the fog of war as last drawn, redrawn only when the viewport or the fog cells under it change
+	struct FogCache {
+		VideoBufferPtr buffer;
+		Region viewport;
+		const Bitmap* explored = nullptr;
+		const Bitmap* visible = nullptr;
+		// explored and visible bits of the cells under the viewport
+		std::vector<uint8_t> cells;
+	};
+	mutable FogCache fogCache;
 	std::unordered_map<const void*, std::pair<VideoBufferPtr, Region>> objectStencils;
+	// actors drawn in the last frame, back to front
+	std::vector<Actor*> pickList;
 
 public:
 	Map(TileMap *tm, TileProps tileProps, Holder<Sprite2D> sm);
@@ -459,6 +472,8 @@ public:
 	ResRef ResolveTerrainSound(const ResRef &sound, const Point &pos) const;
 	void DoStepForActor(Actor *actor, ieDword time) const;
 	void UpdateEffects();
+	/* advances projectiles and particles by a game tick and removes the expired ones */
+	void UpdateProjectiles();
 	/* removes empty heaps and returns total itemcount */
 	int ConsolidateContainers();
 	/* transfers all ever visible piles (loose items) to the specified position */
@@ -523,6 +538,10 @@ public:
 	Actor* GetActor(const ieVariable& Name, int flags) const;
 	Actor* GetActor(int i, bool any) const;
 	Actor* GetActor(const Point &p, int flags, const Movable *checker = NULL) const;
+	/** like GetActor and GetActorsInRect, but only consider what was drawn
+	 * in the last frame, frontmost first; meant for mouse picking */
+	Actor* PickActor(const Point &p, int flags) const;
+	std::vector<Actor*> PickActorsInRect(const Region& rgn, int excludeFlags) const;
 	Scriptable *GetScriptableByDialog(const ResRef& resref) const;
 	Actor *GetItemByDialog(const ResRef& resref) const;
 	Actor *GetActorByResource(const ResRef& resref) const;
@@ -613,6 +632,8 @@ public:
 
 	bool IsVisible(const Point &p) const;
 	bool IsExplored(const Point &p) const;
+	/* bumped whenever a tile of ExploredBitmap changes, so consumers can cache derived data */
+	unsigned int ExploredGeneration() const { return exploredGeneration; }
 	bool IsVisibleLOS(const Point &s, const Point &d, const Actor *caller = NULL) const;
 	bool IsWalkableTo(const Point &s, const Point &d, bool actorsAreBlocking, const Actor *caller) const;
 
@@ -685,6 +706,7 @@ private:
 	void DrawPortal(const InfoPoint *ip, int enable);
 	void DrawHighlightables(const Region& viewport) const;
 	void DrawFogOfWar(const Bitmap* explored_mask, const Bitmap* visible_mask, const Region& viewport) const;
+	void RenderFogOfWar(const Bitmap* explored_mask, const Bitmap* visible_mask, const Region& viewport) const;
 	
 	Size PropsSize() const noexcept;
 	Size FogMapSize() const;
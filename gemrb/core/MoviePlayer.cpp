@@ -22,8 +22,12 @@
 
 #include "GUI/Label.h"
 #include "Interface.h"
+#include "Palette.h"
 
 #include <chrono>
+#include <condition_variable>
+#include <cstdarg>
+#include <mutex>
 #include <thread>
 
 using namespace std::chrono;
@@ -32,6 +36,145 @@ namespace GemRB {
 
 const TypeID MoviePlayer::ID = { "MoviePlayer" };
 
+// a CPU side stand-in for the real video buffer, so decoders can run off the main thread
+// it keeps a copy of whatever the decoder handed to CopyPixels and replays it on the main thread
+class MovieFrameBuffer : public VideoBuffer {
+	Video::BufferFormat format;
+	Region dest;
+	std::vector<uint8_t> planes[3];
+	int pitches[3] {};
+	PaletteHolder palette;
+	bool hasPixels = false;
+
+	void CopyPlane(int plane, const void* src, int pitch, int rowBytes, int rows) {
+		planes[plane].resize(rowBytes * rows);
+		pitches[plane] = rowBytes;
+		const uint8_t* srcRow = static_cast<const uint8_t*>(src);
+		for (int y = 0; y < rows; ++y, srcRow += pitch) {
+			std::copy(srcRow, srcRow + rowBytes, planes[plane].data() + y * rowBytes);
+		}
+	}
+
+public:
+	size_t framePos = 0;
+	microseconds frameWait {0};
+
+	MovieFrameBuffer(const Region& r, Video::BufferFormat fmt)
+	: VideoBuffer(r), format(fmt) {}
+
+	void Reset() { hasPixels = false; }
+
+	void Clear(const Region&) override {}
+
+	void CopyPixels(const Region& bufDest, const void* pixelBuf, const int* pitch, ...) override {
+		dest = bufDest;
+		hasPixels = true;
+
+		va_list args;
+		va_start(args, pitch);
+		switch (format) {
+			case Video::BufferFormat::YV12:
+				CopyPlane(0, pixelBuf, *pitch, bufDest.w, bufDest.h);
+				for (int plane = 1; plane < 3; ++plane) {
+					const uint8_t* buf = va_arg(args, const uint8_t*);
+					const int* planePitch = va_arg(args, const int*);
+					CopyPlane(plane, buf, *planePitch, (bufDest.w + 1) / 2, (bufDest.h + 1) / 2);
+				}
+				break;
+			case Video::BufferFormat::RGBPAL8:
+				{
+					CopyPlane(0, pixelBuf, pitch ? *pitch : bufDest.w, bufDest.w, bufDest.h);
+					// the decoder keeps changing its palette, so take a snapshot
+					const Palette* pal = va_arg(args, const Palette*);
+					if (!palette) palette = MakeHolder<Palette>();
+					palette->CopyColorRange(std::begin(pal->col), std::end(pal->col), 0);
+				}
+				break;
+			case Video::BufferFormat::RGB555:
+				CopyPlane(0, pixelBuf, pitch ? *pitch : bufDest.w * 2, bufDest.w * 2, bufDest.h);
+				break;
+			default:
+				CopyPlane(0, pixelBuf, pitch ? *pitch : bufDest.w * 4, bufDest.w * 4, bufDest.h);
+				break;
+		}
+		va_end(args);
+	}
+
+	bool RenderOnDisplay(void*) const override { return false; }
+
+	void Present(VideoBuffer& target) const {
+		if (!hasPixels) return;
+
+		switch (format) {
+			case Video::BufferFormat::YV12:
+				target.CopyPixels(dest, planes[0].data(), &pitches[0],
+								  planes[1].data(), &pitches[1],
+								  planes[2].data(), &pitches[2]);
+				break;
+			case Video::BufferFormat::RGBPAL8:
+				target.CopyPixels(dest, planes[0].data(), nullptr, palette.get());
+				break;
+			default:
+				target.CopyPixels(dest, planes[0].data());
+				break;
+		}
+	}
+};
+
+// bounded ring of frames between the decoder thread (producer) and Play (consumer)
+class MovieFrameQueue {
+	std::vector<MovieFrameBuffer> frames;
+	size_t head = 0;
+	size_t count = 0;
+	bool done = false;
+	std::mutex mutex;
+	std::condition_variable cv;
+
+public:
+	MovieFrameQueue(size_t size, const Region& r, Video::BufferFormat fmt)
+	: frames(size, MovieFrameBuffer(r, fmt)) {}
+
+	// producer side: a free slot, or nullptr once the queue was shut down
+	MovieFrameBuffer* AcquireFree() {
+		std::unique_lock<std::mutex> lock(mutex);
+		cv.wait(lock, [this] { return done || count < frames.size(); });
+		if (done) return nullptr;
+		return &frames[(head + count) % frames.size()];
+	}
+
+	void Commit() {
+		std::lock_guard<std::mutex> lock(mutex);
+		++count;
+		cv.notify_all();
+	}
+
+	// consumer side: the oldest decoded frame, or nullptr when decoding has ended and the queue is drained
+	MovieFrameBuffer* Front() {
+		std::unique_lock<std::mutex> lock(mutex);
+		cv.wait(lock, [this] { return done || count > 0; });
+		if (count == 0) return nullptr;
+		return &frames[head];
+	}
+
+	void Pop() {
+		std::lock_guard<std::mutex> lock(mutex);
+		head = (head + 1) % frames.size();
+		--count;
+		cv.notify_all();
+	}
+
+	size_t Count() {
+		std::lock_guard<std::mutex> lock(mutex);
+		return count;
+	}
+
+	void Finish() {
+		std::lock_guard<std::mutex> lock(mutex);
+		done = true;
+		cv.notify_all();
+	}
+};
+
 MoviePlayer::~MoviePlayer(void)
 {
 	Stop();
@@ -83,31 +226,98 @@ void MoviePlayer::Play(Window* win)
 	// not only that but the Play method blocks until movie is done/stopped.
 	win->Focus(); // we bypass the WindowManager for drawing, but for event handling we need this
 	isPlaying = true;
+	if (decodeAhead) {
+		PlayDecodeAhead(vb, subBuf);
+	} else {
+		do {
+			// taking over the application runloop...
+			
+			// we could draw all the windows if we wanted to be able to have videos that aren't fullscreen
+			// However, since we completely block the normal game loop we will bypass WindowManager drawing
+			//WindowManager::DefaultWindowManager().DrawWindows();
+			
+			// first draw the window for play controls/subtitles
+			//win->Draw();
+			
+			video->PushDrawingBuffer(vb);
+			if (DecodeFrame(*vb) == false) {
+				Stop(); // error / end
+			}
+			
+			if (subtitles && showSubtitles) {
+				assert(subBuf);
+				// we purposely draw on the window, which may be larger than the video
+				video->PushDrawingBuffer(subBuf);
+				subtitles->RenderInBuffer(*subBuf, framePos);
+			}
+			// TODO: pass movie fps (and remove the cap from within the movie decoders)
+		} while ((video->SwapBuffers(0) == GEM_OK) && isPlaying);
+	}
+
+	delete win->View::RemoveSubview(mpc);
+}
+
+void MoviePlayer::PlayDecodeAhead(const VideoBufferPtr& vb, const VideoBufferPtr& subBuf)
+{
+	Video* video = core->GetVideoDriver();
+	// about a third of a second of video, enough to ride out the occasional expensive keyframe
+	MovieFrameQueue queue(8, vb->Rect(), movieFormat);
+
+	std::thread decoder([this, &queue] {
+		while (isPlaying) {
+			MovieFrameBuffer* frame = queue.AcquireFree();
+			if (!frame) break;
+
+			frame->Reset();
+			if (!DecodeFrame(*frame)) break; // error / end
+			frame->framePos = framePos;
+			frame->frameWait = frame_wait;
+			queue.Commit();
+		}
+		queue.Finish();
+	});
+
+	lastTime = microseconds(0);
 	do {
-		// taking over the application runloop...
-		
-		// we could draw all the windows if we wanted to be able to have videos that aren't fullscreen
-		// However, since we completely block the normal game loop we will bypass WindowManager drawing
-		//WindowManager::DefaultWindowManager().DrawWindows();
-		
-		// first draw the window for play controls/subtitles
-		//win->Draw();
-		
-		video->PushDrawingBuffer(vb);
-		if (DecodeFrame(*vb) == false) {
-			Stop(); // error / end
+		const MovieFrameBuffer* frame = queue.Front();
+		if (!frame) {
+			Stop();
+			break;
+		}
+
+		if (lastTime == microseconds(0)) {
+			timer_start();
+		} else {
+			// present on the movie timebase rather than whenever decoding finished
+			microseconds now = get_current_time();
+			// more than a frame behind: drop frames without presenting them
+			while (now > lastTime + frame->frameWait * 2 && queue.Count() > 1) {
+				lastTime += frame->frameWait;
+				video_skippedframes++;
+				queue.Pop();
+				frame = queue.Front();
+			}
+			microseconds due = lastTime + frame->frameWait;
+			if (due > now) {
+				std::this_thread::sleep_for(due - now);
+			}
+			lastTime = due;
 		}
-		
+
+		video->PushDrawingBuffer(vb);
+		frame->Present(*vb);
 		if (subtitles && showSubtitles) {
 			assert(subBuf);
 			// we purposely draw on the window, which may be larger than the video
 			video->PushDrawingBuffer(subBuf);
-			subtitles->RenderInBuffer(*subBuf, framePos);
+			subtitles->RenderInBuffer(*subBuf, frame->framePos);
 		}
-		// TODO: pass movie fps (and remove the cap from within the movie decoders)
+		queue.Pop();
 	} while ((video->SwapBuffers(0) == GEM_OK) && isPlaying);
 
-	delete win->View::RemoveSubview(mpc);
+	isPlaying = false;
+	queue.Finish();
+	decoder.join();
 }
 
 void MoviePlayer::Stop()
@@ -125,19 +335,4 @@ void MoviePlayer::timer_start()
 	lastTime = get_current_time();
 }
 
-void MoviePlayer::timer_wait(microseconds frameWait)
-{
-	auto time = get_current_time();
-
-	while (time - lastTime > frameWait) {
-		time -= frameWait;
-		video_frameskip++;
-	}
-
-	microseconds to_sleep = frameWait - (time - lastTime);
-	std::this_thread::sleep_for(to_sleep);
-
-	timer_start();
-}
-
 }
@@ -37,6 +37,7 @@
 #include "Strings/String.h"
 #include "Video/Video.h"
 
+#include <atomic>
 #include <chrono>
 
 namespace GemRB {
@@ -78,10 +79,12 @@ public:
 	};
 
 private:
-	bool isPlaying = false;
+	std::atomic<bool> isPlaying {false};
 	bool showSubtitles = false;
 	SubtitleSet* subtitles = nullptr;
 
+	void PlayDecodeAhead(const VideoBufferPtr& vb, const VideoBufferPtr& subBuf);
+
 protected:
 	// NOTE: make sure any new movie plugins set these!
 	Video::BufferFormat movieFormat = Video::BufferFormat::DISPLAY;
@@ -91,16 +94,19 @@ protected:
 	microseconds lastTime = microseconds(0);
 
 	microseconds frame_wait = microseconds(0);
-	unsigned int video_frameskip = 0;
 	unsigned int video_skippedframes = 0;
 
+	// plugins whose DecodeFrame only copies pixels into the buffer (no driver calls, no waiting)
+	// can set this, they are then decoded on a worker thread ahead of presentation
+	// and Play takes care of the pacing and dropping late frames
+	bool decodeAhead = false;
+
 protected:
 	void DisplaySubtitle(const String& sub);
 	void PresentMovie(const Region&, Video::BufferFormat fmt);
 
 	microseconds get_current_time() const;
 	void timer_start();
-	void timer_wait(microseconds frameWait);
 
 	virtual bool DecodeFrame(VideoBuffer&) = 0;
 
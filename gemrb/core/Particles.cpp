@@ -164,6 +164,14 @@ void Particles::Draw(Point p)
 		p.x-=pos.x;
 		p.y-=pos.y;
 	}
+
+	// the primitive types are collected per spark phase (and thus color), so
+	// the driver gets a few runs of equal color instead of a call per particle
+	static std::vector<Point> phasePoints[MAX_SPARK_PHASE];
+	for (auto& bucket : phasePoints) {
+		bucket.clear();
+	}
+
 	ieWord i = size;
 	while (i--) {
 		if (points[i].state == -1) {
@@ -220,20 +228,47 @@ void Particles::Draw(Point p)
 			}
 			break;
 		case SP_TYPE_CIRCLE:
-			video->DrawCircle (points[i].pos - p, 2, clr);
-			break;
 		case SP_TYPE_POINT:
 		default:
-			video->DrawPoint(points[i].pos - p, clr);
+			phasePoints[state].push_back(points[i].pos - p);
 			break;
 		// this is more like a raindrop
 		case SP_TYPE_LINE:
 			if (length) {
-				video->DrawLine (points[i].pos - p, points[i].pos - p + Point((i&1), length), clr);
+				phasePoints[state].push_back(points[i].pos - p);
+				phasePoints[state].push_back(points[i].pos - p + Point((i&1), length));
 			}
 			break;
 		}
 	}
+
+	if (type == SP_TYPE_BITMAP) {
+		return;
+	}
+
+	static std::vector<Point> batch;
+	static std::vector<Color> colors;
+	batch.clear();
+	colors.clear();
+	for (int state = 0; state < MAX_SPARK_PHASE; ++state) {
+		const auto& bucket = phasePoints[state];
+		batch.insert(batch.end(), bucket.begin(), bucket.end());
+		size_t count = type == SP_TYPE_LINE ? bucket.size() / 2 : bucket.size();
+		colors.insert(colors.end(), count, sparkcolors[color][state]);
+	}
+
+	switch (type) {
+	case SP_TYPE_CIRCLE:
+		video->DrawCircles(batch, 2, colors);
+		break;
+	case SP_TYPE_LINE:
+		video->DrawLineSegments(batch, colors);
+		break;
+	case SP_TYPE_POINT:
+	default:
+		video->DrawPoints(batch, colors);
+		break;
+	}
 }
 
 void Particles::AddParticles(int count)
@@ -36,15 +36,23 @@ Gem_Polygon::Gem_Polygon(std::vector<Point>&& points, const Region *bbox)
 	else RecalcBBox();
 	
 	assert(!BBox.size.IsInvalid());
-	
-	Rasterize();
 }
 
-void Gem_Polygon::Rasterize()
+const std::vector<Gem_Polygon::LineSegment>& Gem_Polygon::GetRasterData() const
+{
+	if (rowOffsets.empty()) {
+		Rasterize();
+	}
+	return rasterData;
+}
+
+void Gem_Polygon::Rasterize() const
 {
 	assert(BBox.h >= 1);
-	rasterData.resize(BBox.h - 1);
+	int rows = BBox.h - 1;
 
+	// collect the spans of all rows, then sort them by row and x in one go
+	std::vector<LineSegment> spans;
 	for (const auto& trap : ComputeTrapezoids()) {
 		int y_top = trap.y1 - BBox.y; // inclusive
 		int y_bot = trap.y2 - BBox.y; // exclusive
@@ -73,33 +81,33 @@ void Gem_Polygon::Rasterize()
 			if (rt >= BBox.w) rt = BBox.w - 1;
 			if (lt >= rt) { continue; } // clipped
 
-			bool merged = false;
-			for (auto& seg : rasterData[y]) {
-				if (rt < seg.first.x || lt > seg.second.x) {
-					continue;
-				}
-
-				// merge overlapping segment
-				seg.first.x = std::min<int>(seg.first.x, lt);
-				seg.second.x = std::max<int>(seg.second.x, rt);
-				merged = true;
-				break;
-			}
+			spans.emplace_back(Point(lt, y), Point(rt, y));
+		}
+	}
 
-			if (!merged) {
-				rasterData[y].emplace_back(Point(lt, y), Point(rt, y));
+	std::sort(spans.begin(), spans.end(), [](const LineSegment& a, const LineSegment& b) {
+		if (a.first.y != b.first.y) return a.first.y < b.first.y;
+		return a.first.x < b.first.x;
+	});
+
+	rasterData.clear();
+	rasterData.reserve(spans.size());
+	rowOffsets.assign(rows + 1, 0);
+	for (const auto& span : spans) {
+		// merge overlapping segments
+		if (!rasterData.empty()) {
+			LineSegment& last = rasterData.back();
+			if (last.first.y == span.first.y && span.first.x <= last.second.x) {
+				last.second.x = std::max<int>(last.second.x, span.second.x);
+				continue;
 			}
 		}
+		rasterData.push_back(span);
+		rowOffsets[span.first.y + 1] = static_cast<uint32_t>(rasterData.size());
 	}
-
-	for (auto& segments : rasterData) {
-		std::sort(segments.begin(), segments.end(), [](const LineSegment& a, const LineSegment& b) {
-			// return true if a.x < b.x, assume segments can't overlap except possibly the endpoints
-			assert(a.first.y == b.first.y);
-			assert(a.second.y == b.second.y);
-			assert(a.first.x <= a.second.x);
-			return a.first.x < b.first.x;
-		});
+	// rows without segments start where the previous one ended
+	for (int y = 1; y <= rows; ++y) {
+		rowOffsets[y] = std::max(rowOffsets[y], rowOffsets[y - 1]);
 	}
 }
 
@@ -131,17 +139,22 @@ bool Gem_Polygon::PointIn(const Point& p) const
 {
 	Point relative = p - BBox.origin;
 
-	if (relative.y < 0 || relative.y >= int(rasterData.size())) {
+	// don't bother rasterizing for points that are nowhere near
+	if (relative.y < 0 || relative.y >= BBox.h - 1 || relative.x < 0 || relative.x >= BBox.w) {
 		return false;
 	}
 
-	for (const auto& seg : rasterData[relative.y]) {
-		if (relative.x >= seg.first.x) {
-			return relative.x <= seg.second.x;
-		}
+	GetRasterData();
+	auto begin = rasterData.begin() + rowOffsets[relative.y];
+	auto end = rasterData.begin() + rowOffsets[relative.y + 1];
+	// the last segment starting at or before the point is the only candidate
+	auto seg = std::upper_bound(begin, end, relative.x, [](int x, const LineSegment& s) {
+		return x < s.first.x;
+	});
+	if (seg == begin) {
+		return false;
 	}
-
-	return false;
+	return relative.x <= (seg - 1)->second.x;
 }
 
 bool Gem_Polygon::PointIn(int tx, int ty) const
@@ -164,18 +177,17 @@ bool Gem_Polygon::IntersectsRect(const Region& rect) const
 	}
 
 	Point relative = rect.origin - BBox.origin;
-	if (relative.y < 0 || relative.y + rect.h >= int(rasterData.size())) {
+	if (relative.y < 0 || relative.y + rect.h >= BBox.h - 1) {
 		return false;
 	}
 
-	for (int y = relative.y; y < relative.y + rect.h; ++y) {
-		int xmin = relative.x;
-		int xmax = relative.x + rect.w;
-
-		for (const auto& seg : rasterData[y]) {
-			if (xmax >= seg.first.x && xmin <= seg.second.x) {
-				return true;
-			}
+	GetRasterData();
+	int xmin = relative.x;
+	int xmax = relative.x + rect.w;
+	for (uint32_t i = rowOffsets[relative.y]; i < rowOffsets[relative.y + rect.h]; ++i) {
+		const auto& seg = rasterData[i];
+		if (xmax >= seg.first.x && xmin <= seg.second.x) {
+			return true;
 		}
 	}
 
@@ -37,20 +37,29 @@ public:
 };
 
 class GEM_EXPORT Gem_Polygon {
+public:
+	using LineSegment = std::pair<Point, Point>;
+
+private:
 	std::vector<Trapezoid> ComputeTrapezoids() const;
 	void RecalcBBox();
-	void Rasterize();
+	void Rasterize() const;
 
-public:
-	using LineSegment = std::pair<Point, Point>;
+	// most polygons are never drawn or hit-tested, so they are only
+	// rasterized on first use; all the rows are kept in one array and
+	// rowOffsets[y] is the first segment of row y (with a final end entry)
+	mutable std::vector<LineSegment> rasterData; // same as vertices, but relative to BBox
+	mutable std::vector<uint32_t> rowOffsets;
 
+public:
 	Gem_Polygon(std::vector<Point>&&, const Region *bbox = nullptr);
 
 	Region BBox;
 	std::vector<Point> vertices;
-	std::vector<std::vector<LineSegment>> rasterData; // same as vertices, but relative to BBox
 
 	size_t Count() const {return vertices.size();}
+	// the horizontal segments covering the polygon, ordered by row and x
+	const std::vector<LineSegment>& GetRasterData() const;
 
 	bool PointIn(const Point &p) const;
 	bool PointIn(int x, int y) const;
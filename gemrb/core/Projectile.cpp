@@ -75,12 +75,32 @@ Projectile::AnimArray Projectile::CreateAnimations(const ResRef& bamres, int Seq
 	//reporting bigger face count than possible by the animation
 	if (Aim>Max) Aim=Max;
 
-	if(ExtFlags&PEF_PILLAR) {
+	bool pillar = ExtFlags & PEF_PILLAR;
+	if (pillar) {
 		Aim = Max;
-		return CreateCompositeAnimation(af, Seq);
-	} else {
-		return CreateOrientedAnimations(af, Seq);
 	}
+
+	//building the orientations means copying every mirrored frame, so it is
+	//done once per animation and the projectiles get a copy sharing the frames
+	const AnimArray* prebuilt = server->GetAnimations(bamres, Seq, Aim, pillar);
+	if (!prebuilt) {
+		AnimArray anims = pillar ? CreateCompositeAnimation(af, Seq) : CreateOrientedAnimations(af, Seq);
+		prebuilt = &server->AddAnimations(bamres, Seq, Aim, pillar, std::move(anims));
+	}
+
+	AnimArray anims = *prebuilt;
+	for (auto& anim : anims) {
+		if (!anim) continue;
+
+		//animations are started at a random frame position
+		//Always start from 0, unless set otherwise
+		if (ExtFlags&PEF_RANDOM) {
+			anim.SetFrame(RAND<Animation::index_t>(0, anim.GetFrameCount() - 1));
+		} else {
+			anim.SetFrame(0);
+		}
+	}
+	return anims;
 }
 
 //Seq is the first cycle to use in the composite
@@ -92,12 +112,6 @@ Projectile::AnimArray Projectile::CreateCompositeAnimation(const AnimationFactor
 		int c = Cycle+Seq;
 		Animation* a = af->GetCycle( c );
 		if (!a) continue;
-		
-		//animations are started at a random frame position
-		//Always start from 0, unless set otherwise
-		if (!(ExtFlags&PEF_RANDOM)) {
-			a->SetFrame(0);
-		}
 
 		a->gameAnimation = true;
 		
@@ -144,12 +158,6 @@ Projectile::AnimArray Projectile::CreateOrientedAnimations(const AnimationFactor
 		}
 		Animation* a = af->GetCycle( c );
 		if (!a) continue;
-		
-		//animations are started at a random frame position
-		//Always start from 0, unless set otherwise
-		if (!(ExtFlags&PEF_RANDOM)) {
-			a->SetFrame(0);
-		}
 
 		a->MirrorAnimation(mirrorFlags);
 		a->gameAnimation = true;
@@ -1231,22 +1239,39 @@ int Projectile::Update()
 	}
 
 	int pause = core->IsFreezed();
-	if (pause) {
-		return 1;
-	}
-
 	const Game *game = core->GetGame();
-	if (game && game->IsTimestopActive() && !(TFlags&PTF_TIMELESS)) {
-		return 1;
+	if (!pause && !(game && game->IsTimestopActive() && !(TFlags&PTF_TIMELESS))) {
+		//recreate path if target has moved
+		if(Target) {
+			SetTarget(Target, false);
+		}
+
+		if (phase == P_TRAVEL || phase == P_TRAVEL2) {
+			DoStep();
+		}
 	}
 
-	//recreate path if target has moved
-	if(Target) {
-		SetTarget(Target, false);
+	if (drawSpark) {
+		area->Sparkle(0, SparkColor, SPARKLE_EXPLOSION, Pos, 0, GetZPos());
+		drawSpark = 0;
 	}
 
-	if (phase == P_TRAVEL || phase == P_TRAVEL2) {
-		DoStep();
+	switch (phase) {
+		case P_TRIGGER: case P_EXPLODING1: case P_EXPLODING2:
+			CheckTrigger(Extension->TriggerRadius);
+			if (phase == P_EXPLODING1 || phase == P_EXPLODING2) {
+				UpdateExplosion();
+			}
+			break;
+		case P_EXPLODED:
+			//wait until all children expire
+			if (!UpdateChildren()) {
+				phase = P_EXPIRED;
+				return 0;
+			}
+			break;
+		default:
+			break;
 	}
 	return 1;
 }
@@ -1262,45 +1287,36 @@ void Projectile::Draw(const Region& viewport)
 			if (Extension->AFlags&PAF_VISIBLE) {
 				DrawTravel(viewport);
 			}
-
-			CheckTrigger(Extension->TriggerRadius);
-			if (phase == P_EXPLODING1 || phase == P_EXPLODING2) {
-				DrawExplosion(viewport);
-			}
+			DrawChildren(viewport);
 			break;
 		case P_TRAVEL: case P_TRAVEL2:
 			//There is no Extension for simple traveling projectiles!
 			DrawTravel(viewport);
 			return;
 		default:
-			DrawExploded(viewport);
+			DrawChildren(viewport);
 			return;
 	}
 }
 
-bool Projectile::DrawChildren(const Region& vp)
+bool Projectile::UpdateChildren()
 {
-	bool drawn = false;
 	for (auto it = children.begin(); it != children.end();){
 		if (it->Update()) {
-			it->DrawTravel(vp);
-			drawn = true;
 			++it;
 		} else {
 			it = children.erase(it);
 		}
 	}
 
-	return drawn;
+	return !children.empty();
 }
 
-//draw until all children expire
-void Projectile::DrawExploded(const Region& viewport)
+void Projectile::DrawChildren(const Region& vp)
 {
-	if (DrawChildren(viewport)) {
-		return;
+	for (auto& child : children) {
+		child.DrawTravel(vp);
 	}
-	phase = P_EXPIRED;
 }
 
 void Projectile::SpawnFragment(Point &dest)
@@ -1319,7 +1335,7 @@ void Projectile::SpawnFragment(Point &dest)
 	}
 }
 
-void Projectile::DrawExplosion(const Region& vp)
+void Projectile::UpdateExplosion()
 {
 	//This seems to be a needless safeguard
 	if (!Extension) {
@@ -1328,7 +1344,7 @@ void Projectile::DrawExplosion(const Region& vp)
 	}
 
 	StopSound();
-	DrawChildren(vp);
+	UpdateChildren();
 
 	int pause = core->IsFreezed();
 	if (pause) {
@@ -1373,8 +1389,7 @@ void Projectile::DrawExplosion(const Region& vp)
 		//Extension->ExplColor fake color for single shades (blue,green,red flames)
 		//Extension->FragAnimID the animation id for the character animation
 		//This color is not used in the original game
-		Point pos = Pos - vp.origin;
-		area->Sparkle(0, Extension->ExplColor, SPARKLE_EXPLOSION, pos, Extension->FragAnimID, GetZPos());
+		area->Sparkle(0, Extension->ExplColor, SPARKLE_EXPLOSION, Pos, Extension->FragAnimID, GetZPos());
 	}
 
 	if(Shake) {
@@ -1759,12 +1774,6 @@ void Projectile::DrawTravel(const Region& viewport)
 			Draw(frame, pos, flags, tint2);
 		}
 	}
-
-	if (drawSpark) {
-		area->Sparkle(0,SparkColor, SPARKLE_EXPLOSION, pos, 0, GetZPos() );
-		drawSpark = 0;
-	}
-
 }
 
 int Projectile::GetZPos() const
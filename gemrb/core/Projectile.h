@@ -406,9 +406,9 @@ public:
 	void SetDelay(int delay);
 	void MoveTo(Map *map, const Point &Des);
 	void ClearPath();
-	//handle phases, return 0 when expired
+	//handle phases, called once per game tick, return 0 when expired
 	int Update();
-	//draw object
+	//draw object, no state besides the animations is changed here
 	void Draw(const Region &screen);
 	void SetGradient(int gradient, bool tinted);
 	void StaticTint(const Color &newtint);
@@ -448,10 +448,11 @@ private:
 	void SetupWall();
 	void DrawLine(const Region &screen, int face, BlitFlags flag);
 	void DrawTravel(const Region &screen);
-	bool DrawChildren(const Region &screen);
-	void DrawExplosion(const Region &screen);
+	//returns false when all children expired
+	bool UpdateChildren();
+	void DrawChildren(const Region &screen);
+	void UpdateExplosion();
 	void SpawnFragment(Point &pos);
-	void DrawExploded(const Region &screen);
 	int GetTravelPos(int face) const;
 	int GetShadowPos(int face) const;
 	void SetFrames(int face, int frame1, int frame2);
@@ -106,6 +106,27 @@ Projectile *ProjectileServer::CreateDefaultProjectile(size_t idx)
 	return pro;
 }
 
+const std::vector<Animation>* ProjectileServer::GetAnimations(const ResRef& bam, int seq, int aim, bool pillar) const
+{
+	auto it = animations.find(bam);
+	if (it == animations.end()) {
+		return nullptr;
+	}
+	for (const auto& set : it->second) {
+		if (set.seq == seq && set.aim == aim && set.pillar == pillar) {
+			return &set.anims;
+		}
+	}
+	return nullptr;
+}
+
+const std::vector<Animation>& ProjectileServer::AddAnimations(const ResRef& bam, int seq, int aim, bool pillar, std::vector<Animation>&& anims)
+{
+	auto& sets = animations[bam];
+	sets.push_back(AnimationSet{seq, aim, pillar, std::move(anims)});
+	return sets.back().anims;
+}
+
 //this function can return only projectiles listed in projectl.ids
 Projectile *ProjectileServer::GetProjectileByName(const ResRef &resname)
 {
@@ -24,8 +24,10 @@
 #include "exports.h"
 
 #include "Projectile.h"
+#include "Resource.h"
 
 #include <memory>
+#include <vector>
 
 namespace GemRB {
 
@@ -52,6 +54,10 @@ public:
 	size_t GetHighestProjectileNumber() const;
 	//creates an empty projectile on the fly
 	Projectile *CreateDefaultProjectile(size_t idx);
+	//returns the prebuilt orientations of a projectile animation, NULL if they weren't built yet
+	const std::vector<Animation>* GetAnimations(const ResRef& bam, int seq, int aim, bool pillar) const;
+	//stores the orientations built by a projectile, so the next ones can just copy them
+	const std::vector<Animation>& AddAnimations(const ResRef& bam, int seq, int aim, bool pillar, std::vector<Animation>&& anims);
 private:
 	//this represents a line of projectl.ids
 	struct ProjectileEntry
@@ -77,8 +83,18 @@ private:
 		int flags = 0;
 	};
 
+	//the frames are shared, only the mirrored orientations hold their own copies
+	struct AnimationSet
+	{
+		int seq;
+		int aim;
+		bool pillar;
+		std::vector<Animation> anims;
+	};
+
 	std::vector<ProjectileEntry> projectiles; //this is the list of projectiles
 	std::vector<ExplosionEntry> explosions;   //this is the list of explosion resources
+	ResRefMap<std::vector<AnimationSet>> animations; //prebuilt travel and shadow animations
 	// internal function: what is max valid projectile id?
 	size_t PrepareSymbols(const std::shared_ptr<SymbolMgr>& projlist) const;
 	// internal function: read projectiles
@@ -27,6 +27,70 @@
 
 namespace GemRB {
 
+std::atomic<unsigned int> ResourceManager::generation { 0 };
+std::deque<std::string> ResourceManager::forgotten;
+unsigned int ResourceManager::forgottenCount = 0;
+std::mutex ResourceManager::forgottenLock;
+
+void ResourceManager::InvalidateIndex()
+{
+	generation++;
+}
+
+void ResourceManager::ForgetResource(const char* path)
+{
+	char filename[_MAX_PATH];
+	ExtractFileFromPath(filename, path);
+	std::string key = filename;
+	StringToLower(key);
+
+	std::lock_guard<std::mutex> l(forgottenLock);
+	forgotten.push_back(std::move(key));
+	if (forgotten.size() > MAX_FORGOTTEN) {
+		forgotten.pop_front();
+	}
+	forgottenCount++;
+}
+
+template <typename T>
+int ResourceManager::FindSource(StringView resRef, const char* ext, const T& type) const
+{
+	std::string key(resRef.c_str(), resRef.length());
+	StringToLower(key);
+	key.push_back('.');
+	key += ext;
+
+	std::lock_guard<std::mutex> l(indexLock);
+	{
+		std::lock_guard<std::mutex> fl(forgottenLock);
+		unsigned int missed = forgottenCount - indexForgotten;
+		if (indexGeneration != generation || missed > forgotten.size()) {
+			index.clear();
+			indexGeneration = generation;
+		} else {
+			for (auto it = forgotten.end() - missed; it != forgotten.end(); ++it) {
+				index.erase(*it);
+			}
+		}
+		indexForgotten = forgottenCount;
+	}
+
+	auto cached = index.find(key);
+	if (cached != index.end()) {
+		return cached->second;
+	}
+
+	int found = NOT_FOUND;
+	for (size_t i = 0; i < searchPath.size(); ++i) {
+		if (searchPath[i]->HasResource(resRef, type)) {
+			found = static_cast<int>(i);
+			break;
+		}
+	}
+	index.emplace(std::move(key), found);
+	return found;
+}
+
 bool ResourceManager::AddSource(const char *path, const char *description, PluginID type, int flags)
 {
 	PluginHolder<ResourceSource> source = MakePluginHolder<ResourceSource>(type);
@@ -45,6 +109,9 @@ bool ResourceManager::AddSource(const char *path, const char *description, Plugi
 	} else {
 		searchPath.push_back(source);
 	}
+
+	std::lock_guard<std::mutex> l(indexLock);
+	index.clear();
 	return true;
 }
 
@@ -60,11 +127,8 @@ bool ResourceManager::Exists(StringView ResRef, SClass_ID type, bool silent) con
 {
 	if (ResRef.empty())
 		return false;
-	// TODO: check various caches
-	for (const auto& path : searchPath) {
-		if (path->HasResource(ResRef, type)) {
-			return true;
-		}
+	if (FindSource(ResRef, core->TypeExt(type), type) != NOT_FOUND) {
+		return true;
 	}
 	if (!silent) {
 		Log(WARNING, "ResourceManager", "'{}.{}' not found...",
@@ -77,13 +141,10 @@ bool ResourceManager::Exists(StringView ResRef, const TypeID *type, bool silent)
 {
 	if (ResRef[0] == '\0')
 		return false;
-	// TODO: check various caches
 	const std::vector<ResourceDesc> &types = PluginMgr::Get()->GetResourceDesc(type);
 	for (const auto& type2 : types) {
-		for (const auto& path : searchPath) {
-			if (path->HasResource(ResRef, type2)) {
-				return true;
-			}
+		if (FindSource(ResRef, type2.GetExt(), type2) != NOT_FOUND) {
+			return true;
 		}
 	}
 	if (!silent) {
@@ -98,7 +159,10 @@ DataStream* ResourceManager::GetResource(StringView ResRef, SClass_ID type, bool
 {
 	if (ResRef.empty())
 		return nullptr;
-	for (const auto& path : searchPath) {
+	// sources before the indexed one don't have it, later ones may still if it fails to open
+	int first = FindSource(ResRef, core->TypeExt(type), type);
+	for (size_t i = first; first != NOT_FOUND && i < searchPath.size(); ++i) {
+		const auto& path = searchPath[i];
 		DataStream *ds = path->GetResource(ResRef, type);
 		if (ds) {
 			if (!silent) {
@@ -122,7 +186,9 @@ Resource* ResourceManager::GetResource(StringView ResRef, const TypeID *type, bo
 	}
 	const std::vector<ResourceDesc> &types = PluginMgr::Get()->GetResourceDesc(type);
 	for (const auto& type2 : types) {
-		for (const auto& path : searchPath) {
+		int first = FindSource(ResRef, type2.GetExt(), type2);
+		for (size_t i = first; first != NOT_FOUND && i < searchPath.size(); ++i) {
+			const auto& path = searchPath[i];
 			DataStream *str = path->GetResource(ResRef, type2);
 			if (!str && useCorrupt && core->UseCorruptedHack) {
 				// don't look at other paths if requested
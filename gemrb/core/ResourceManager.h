@@ -27,6 +27,11 @@
 #include "Resource.h"
 #include "ResourceSource.h"
 
+#include <atomic>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace GemRB {
@@ -57,8 +62,38 @@ public:
 	/** Returns Resource object associated to given resource */
 	Resource* GetResource(StringView resname, const TypeID *type, bool silent = false, bool useCorrupt = false) const;
 
+	/** Forgets what every manager knows about resource locations.
+	 * Call it when the engine replaces whole directories of a source */
+	static void InvalidateIndex();
+	/** Changes every time InvalidateIndex is called */
+	static unsigned int IndexGeneration() { return generation; }
+	/** Forgets only the location of the file at path, for single files
+	 * the engine creates or deletes (cache extraction, area swapout, ...) */
+	static void ForgetResource(const char* path);
+
 private:
+	static constexpr int NOT_FOUND = -1;
+	/** returns the index of the first source having the resource or NOT_FOUND */
+	template <typename T>
+	int FindSource(StringView resRef, const char* ext, const T& type) const;
+
 	std::vector<std::shared_ptr<ResourceSource> > searchPath;
+
+	/** "resref.ext" -> position in searchPath; misses are kept too, so
+	 * repeated probes for missing resources don't hit the disk again */
+	mutable std::unordered_map<std::string, int> index;
+	mutable unsigned int indexGeneration = 0;
+	/** how many ForgetResource calls the index has seen */
+	mutable unsigned int indexForgotten = 0;
+	mutable std::mutex indexLock;
+	static std::atomic<unsigned int> generation;
+
+	/** keys of the latest ForgetResource calls, a manager lagging behind
+	 * more than that clears its whole index */
+	static constexpr size_t MAX_FORGOTTEN = 256;
+	static std::deque<std::string> forgotten;
+	static unsigned int forgottenCount;
+	static std::mutex forgottenLock;
 };
 
 }
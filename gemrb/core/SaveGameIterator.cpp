@@ -40,7 +40,7 @@
 #endif
 
 #include <cassert>
-#include <set>
+#include <cerrno>
 #include <ctime>
 
 #ifdef VITA
@@ -244,14 +244,62 @@ static bool IsSaveGameSlot(const char* Path, const char* slotname)
 	return true;
 }
 
+SaveGameIterator::~SaveGameIterator() noexcept
+{
+	WaitForSaveWriter(false);
+}
+
+void SaveGameIterator::PollSaveWriter() const
+{
+	if (saveWriterDone) {
+		WaitForSaveWriter();
+	}
+}
+
+void SaveGameIterator::WaitForSaveWriter(bool report) const
+{
+	if (!saveWriter.joinable()) {
+		return;
+	}
+	saveWriter.join();
+	saveWriterDone = false;
+	FinishSave(report);
+	// the files were renamed behind the back of the resource managers
+	ResourceManager::InvalidateIndex();
+	slotsDirty = true;
+}
+
+static time_t DirectoryTime(const char* path, ino_t* inode = nullptr)
+{
+	struct stat my_stat;
+	if (stat(path, &my_stat)) {
+		return 0;
+	}
+	if (inode) {
+		*inode = my_stat.st_ino;
+	}
+	return my_stat.st_mtime;
+}
+
 bool SaveGameIterator::RescanSaveGames()
 {
-	// delete old entries
-	save_slots.clear();
+	WaitForSaveWriter();
 
 	char Path[_MAX_PATH];
 	PathJoin(Path, core->config.SavePath, SaveDir().c_str(), nullptr);
 
+	// the GUI asks a lot, but adding, removing or renaming a slot touches the directory
+	time_t dirTime = DirectoryTime(Path);
+	if (!slotsDirty && dirTime && dirTime == scannedTime && scannedPath == Path) {
+		return true;
+	}
+
+	// delete old entries
+	save_slots.clear();
+	if (scannedPath != Path) {
+		slotCache.clear();
+	}
+
 	DirectoryIterator dir(Path);
 	// create the save game directory at first access
 	if (!dir) {
@@ -265,19 +313,39 @@ bool SaveGameIterator::RescanSaveGames()
 		return false;
 	}
 
-	std::set<std::string> slots;
+	// slots that didn't change since the last scan are reused, which saves
+	// checking and listing their files (invalid ones are always checked again)
+	std::map<std::string, CachedSlot> slots;
 	dir.SetFlags(DirectoryIterator::Directories);
 	do {
 		const char *name = dir.GetName();
-		if (IsSaveGameSlot( Path, name )) {
-			slots.emplace(name);
+		char slotPath[_MAX_PATH];
+		PathJoin(slotPath, Path, name, nullptr);
+		ino_t slotInode = 0;
+		time_t slotTime = DirectoryTime(slotPath, &slotInode);
+
+		auto cached = slotCache.find(name);
+		if (cached != slotCache.end() && slotTime && cached->second.mtime == slotTime && cached->second.inode == slotInode) {
+			slots.emplace(name, std::move(cached->second));
+		} else if (IsSaveGameSlot( Path, name )) {
+			slots.emplace(name, CachedSlot { slotTime, slotInode, BuildSaveGame(name) });
 		}
 	} while (++dir);
 
 	for (const auto& slot : slots) {
-		save_slots.push_back(BuildSaveGame(slot));
+		save_slots.push_back(slot.second.save);
 	}
 
+	slotCache.clear();
+	for (auto& slot : slots) {
+		if (slot.second.save) {
+			slotCache.emplace(slot.first, std::move(slot.second));
+		}
+	}
+	scannedPath = Path;
+	scannedTime = dirTime;
+	slotsDirty = false;
+
 	return true;
 }
 
@@ -328,6 +396,17 @@ Holder<SaveGame> SaveGameIterator::BuildSaveGame(std::string slotname)
 	return MakeHolder<SaveGame>(Path, savegameName, core->GameNameResRef, std::move(slotname), prtrt, savegameNumber);
 }
 
+/** a slot we recreated or rotated within the same second would look unchanged */
+void SaveGameIterator::ForgetSlot(const std::string& path) const
+{
+	if (path.empty()) {
+		return;
+	}
+	char name[_MAX_PATH];
+	ExtractFileFromPath(name, path.c_str());
+	slotCache.erase(name);
+}
+
 void SaveGameIterator::PruneQuickSave(StringView folder) const
 {
 	auto FormatQuickSavePath = [folder](int i)
@@ -358,6 +437,7 @@ void SaveGameIterator::PruneQuickSave(StringView folder) const
 		//prune second path
 		std::string from = FormatQuickSavePath(myslots[hole]);
 		myslots.erase(myslots.begin()+hole);
+		ForgetSlot(from);
 		core->DelTree(from.c_str(), false);
 		rmdir(from.c_str());
 	}
@@ -366,15 +446,19 @@ void SaveGameIterator::PruneQuickSave(StringView folder) const
 	for (size_t i = size; i > 0; i--) {
 		std::string from = FormatQuickSavePath(myslots[i]);
 		std::string to = FormatQuickSavePath(myslots[i]+1);
+		ForgetSlot(from);
+		ForgetSlot(to);
 		int errnum = rename(from.c_str(), to.c_str());
 		if (errnum) {
 			error("SaveGameIterator", "Rename error {} when pruning quicksaves!", errnum);
 		}
 	}
+	ResourceManager::InvalidateIndex();
 }
 
-/** Save game to given directory */
-static bool DoSaveGame(const char *Path, bool overrideRunning)
+/** Save game to given directory
+ * when possible, the archive compression is left to the returned compressor */
+static bool DoSaveGame(const char *Path, bool overrideRunning, std::function<int()>& compressor)
 {
 	const Game *game = core->GetGame();
 	//saving areas to cache currently in memory
@@ -390,8 +474,16 @@ static bool DoSaveGame(const char *Path, bool overrideRunning)
 
 	//compress files in cache named: .STO and .ARE
 	//no .CRE would be saved in cache
-	if (core->CompressSave(Path, overrideRunning)) {
-		return false;
+	//the running save is rewritten in place, so it can't wait for the writer
+	if (overrideRunning) {
+		if (core->CompressSave(Path, overrideRunning)) {
+			return false;
+		}
+	} else {
+		compressor = core->CompressSaveLater(Path);
+		if (!compressor) {
+			return false;
+		}
 	}
 
 	//Create .gam file from Game() object
@@ -435,12 +527,75 @@ static bool DoSaveGame(const char *Path, bool overrideRunning)
 	// scale down to get more of the screen and reduce the size
 	preview = core->GetVideoDriver()->SpriteScaleDown(preview, 5);
 	FileStream outfile;
-	outfile.Create( Path, core->GameNameResRef.c_str(), IE_BMP_CLASS_ID );
+	if (!outfile.Create(Path, core->GameNameResRef.c_str(), IE_BMP_CLASS_ID)) {
+		return false;
+	}
 	im->PutImage( &outfile, preview );
+	return outfile.Close();
+}
 
+/** swaps a finished slot in, after moving the one it replaces out of the way */
+static bool SwapInSlot(const std::string& staging, const std::string& slot, const std::string& old, const std::string& trash)
+{
+	bool movedOld = !old.empty() && rename(old.c_str(), trash.c_str()) == 0;
+	if (!old.empty() && !movedOld && errno != ENOENT) {
+		Log(ERROR, "SaveGameIterator", "Rename error when replacing {}!", old);
+		return false;
+	}
+	if (rename(staging.c_str(), slot.c_str())) {
+		Log(ERROR, "SaveGameIterator", "Rename error when writing {}!", slot);
+		if (movedOld) {
+			rename(trash.c_str(), old.c_str());
+		}
+		return false;
+	}
 	return true;
 }
 
+/** swaps the new slot in right away or once the compressor is done */
+int SaveGameIterator::CommitSave(std::function<int()> compressor) const
+{
+	if (!compressor) {
+		PendingSave& job = pendingSave;
+		job.ok = SwapInSlot(job.staging, job.slot, job.old, job.trash);
+		FinishSave(true);
+		return job.ok ? GEM_OK : GEM_ERROR;
+	}
+
+	saveWriter = std::thread([this, compressor]() {
+		PendingSave& job = pendingSave;
+		if (compressor() != GEM_OK) {
+			Log(ERROR, "SaveGameIterator", "Failed to write {}!", job.slot);
+			job.ok = false;
+		} else {
+			job.ok = SwapInSlot(job.staging, job.slot, job.old, job.trash);
+		}
+		saveWriterDone = true;
+	});
+	return GEM_OK;
+}
+
+/** removes what is left of the replaced or the failed slot and tells the player */
+void SaveGameIterator::FinishSave(bool report) const
+{
+	const PendingSave& job = pendingSave;
+	ForgetSlot(job.slot);
+	ForgetSlot(job.old);
+	const std::string& leftover = job.ok ? job.trash : job.staging;
+	core->DelTree(leftover.c_str(), false);
+	rmdir(leftover.c_str());
+
+	if (!report) {
+		return;
+	}
+	size_t message = job.ok ? job.message : size_t(STR_CANTSAVE);
+	displaymsg->DisplayConstantString(message, GUIColors::XPCHANGE);
+	GameControl *gc = core->GetGameControl();
+	if (gc) {
+		gc->SetDisplayText(message, 30);
+	}
+}
+
 static int CanSave()
 {
 	//some of these restrictions might not be needed
@@ -529,8 +684,10 @@ static int CanSave()
 	return 0;
 }
 
-static bool CreateSavePath(char *Path, int index, StringView slotname)
+/** sets up the hidden staging directory the slot is built in, see SwapInSlot */
+static bool CreateSavePath(std::string& staging, std::string& slot, std::string& trash, int index, StringView slotname, const std::string& old)
 {
+	char Path[_MAX_PATH];
 	PathJoin(Path, core->config.SavePath, SaveDir().c_str(), nullptr);
 
 	//if the path exists in different case, don't make it again
@@ -541,11 +698,20 @@ static bool CreateSavePath(char *Path, int index, StringView slotname)
 	//keep the first part we already determined existing
 
 	std::string dir = fmt::format("{:09d}-{}", index, slotname);
-	PathJoin(Path, Path, dir.c_str(), nullptr);
+	slot = fmt::format("{}{}{}", Path, SPathDelimiter, dir);
+	staging = fmt::format("{}{}.new-{}", Path, SPathDelimiter, dir);
+	trash = fmt::format("{}{}.old-{}", Path, SPathDelimiter, dir);
 	//this is required in case the old slot wasn't recognised but still there
-	core->DelTree(Path, false);
-	if (!MakeDirectory(Path)) {
-		Log(ERROR, "SaveGameIterator", "Unable to create save game directory '{}'", Path);
+	if (slot != old) {
+		core->DelTree(slot.c_str(), false);
+		rmdir(slot.c_str());
+	}
+	//and for the leftovers of an interrupted save
+	core->DelTree(trash.c_str(), false);
+	rmdir(trash.c_str());
+	core->DelTree(staging.c_str(), false);
+	if (!MakeDirectory(staging.c_str())) {
+		Log(ERROR, "SaveGameIterator", "Unable to create save game directory '{}'", staging);
 		return false;
 	}
 	return true;
@@ -562,6 +728,8 @@ int SaveGameIterator::CreateSaveGame(int index, bool mqs) const
 		qsave = tab->QueryFieldSigned<int>(index, 1);
 	}
 
+	WaitForSaveWriter();
+	slotsDirty = true;
 	if (mqs) {
 		assert(qsave);
 		PruneQuickSave(slotname);
@@ -571,6 +739,8 @@ int SaveGameIterator::CreateSaveGame(int index, bool mqs) const
 		return cansave;
 
 	bool overrideRunning = false;
+	PendingSave& job = pendingSave;
+	job = PendingSave();
 	//if index is not an existing savegame, we create a unique slotname
 	for (const auto& save : save_slots) {
 		if (save->GetSaveID() != index) continue;
@@ -582,33 +752,20 @@ int SaveGameIterator::CreateSaveGame(int index, bool mqs) const
 			}
 		}
 
-		DeleteSaveGame(save);
+		// it is only replaced once the new slot is complete
+		job.old = save->GetPath();
 		break;
 	}
-	char Path[_MAX_PATH];
-	GameControl *gc = core->GetGameControl();
-	assert(gc);
-	if (!CreateSavePath(Path, index, slotname)) {
-		displaymsg->DisplayConstantString(STR_CANTSAVE, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_CANTSAVE, 30);
-		return GEM_ERROR;
-	}
+	// Save successful / Quick-save successful
+	job.message = qsave ? STR_QSAVESUCCEED : STR_SAVESUCCEED;
 
-	if (!DoSaveGame(Path, overrideRunning)) {
-		displaymsg->DisplayConstantString(STR_CANTSAVE, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_CANTSAVE, 30);
+	std::function<int()> compressor;
+	if (!CreateSavePath(job.staging, job.slot, job.trash, index, slotname, job.old)
+		|| !DoSaveGame(job.staging.c_str(), overrideRunning, compressor)) {
+		FinishSave(true);
 		return GEM_ERROR;
 	}
-
-	// Save successful / Quick-save successful
-	if (qsave) {
-		displaymsg->DisplayConstantString(STR_QSAVESUCCEED, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_QSAVESUCCEED, 30);
-	} else {
-		displaymsg->DisplayConstantString(STR_SAVESUCCEED, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_SAVESUCCEED, 30);
-	}
-	return GEM_OK;
+	return CommitSave(std::move(compressor));
 }
 
 int SaveGameIterator::CreateSaveGame(Holder<SaveGame> save, StringView slotname, bool force) const
@@ -621,9 +778,13 @@ int SaveGameIterator::CreateSaveGame(Holder<SaveGame> save, StringView slotname,
 	if (cannotSave && !force) {
 		return cannotSave;
 	}
+	WaitForSaveWriter();
+	slotsDirty = true;
 
 	int index;
 	bool overrideRunning = false;
+	PendingSave& job = pendingSave;
+	job = PendingSave();
 
 	if (save) {
 		index = save->GetSaveID();
@@ -635,7 +796,8 @@ int SaveGameIterator::CreateSaveGame(Holder<SaveGame> save, StringView slotname,
 			}
 		}
 
-		DeleteSaveGame(save);
+		// it is only replaced once the new slot is complete
+		job.old = save->GetPath();
 		save.release();
 	} else {
 		//leave space for autosaves
@@ -648,26 +810,16 @@ int SaveGameIterator::CreateSaveGame(Holder<SaveGame> save, StringView slotname,
 			}
 		}
 	}
+	// Save successful
+	job.message = STR_SAVESUCCEED;
 
-	GameControl *gc = core->GetGameControl();
-	assert(gc); //this is already checked in CanSave and core only has one if there is a game anyway
-	char Path[_MAX_PATH];
-	if (!CreateSavePath(Path, index, slotname)) {
-		displaymsg->DisplayConstantString(STR_CANTSAVE, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_CANTSAVE, 30);
-		return GEM_ERROR;
-	}
-
-	if (!DoSaveGame(Path, overrideRunning)) {
-		displaymsg->DisplayConstantString(STR_CANTSAVE, GUIColors::XPCHANGE);
-		gc->SetDisplayText(STR_CANTSAVE, 30);
+	std::function<int()> compressor;
+	if (!CreateSavePath(job.staging, job.slot, job.trash, index, slotname, job.old)
+		|| !DoSaveGame(job.staging.c_str(), overrideRunning, compressor)) {
+		FinishSave(true);
 		return GEM_ERROR;
 	}
-
-	// Save successful
-	displaymsg->DisplayConstantString(STR_SAVESUCCEED, GUIColors::XPCHANGE);
-	gc->SetDisplayText(STR_SAVESUCCEED, 30);
-	return GEM_OK;
+	return CommitSave(std::move(compressor));
 }
 
 void SaveGameIterator::DeleteSaveGame(const Holder<SaveGame>& game) const
@@ -676,6 +828,9 @@ void SaveGameIterator::DeleteSaveGame(const Holder<SaveGame>& game) const
 		return;
 	}
 
+	WaitForSaveWriter();
+	slotsDirty = true;
+	ForgetSlot(game->GetPath());
 	core->DelTree(game->GetPath().c_str(), false); //remove all files from folder
 	rmdir(game->GetPath().c_str());
 }
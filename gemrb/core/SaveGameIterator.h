@@ -25,6 +25,12 @@
 
 #include "SaveGame.h"
 
+#include <atomic>
+#include <ctime>
+#include <functional>
+#include <map>
+#include <sys/types.h>
+#include <thread>
 #include <vector>
 
 namespace GemRB {
@@ -35,19 +41,54 @@ class GEM_EXPORT SaveGameIterator {
 private:
 	using charlist = std::vector<Holder<SaveGame>>;
 	charlist save_slots;
+	/** finishes the last save, see DoSaveGame */
+	mutable std::thread saveWriter;
+	/** set by the writer once it is done, see PollSaveWriter */
+	mutable std::atomic<bool> saveWriterDone {false};
+	/** a slot is built in a hidden staging directory and only swapped in
+	 * for the one it replaces once it is complete */
+	struct PendingSave {
+		std::string staging;
+		std::string slot;
+		std::string old;
+		std::string trash;
+		size_t message = 0; // shown when the save worked
+		bool ok = false;
+	};
+	mutable PendingSave pendingSave;
+
+	/** the valid slots of the last scan with the modification time and inode of their directory */
+	struct CachedSlot {
+		time_t mtime;
+		ino_t inode;
+		Holder<SaveGame> save;
+	};
+	mutable std::map<std::string, CachedSlot> slotCache;
+	std::string scannedPath;
+	time_t scannedTime = 0;
+	/** set when we changed the save directory ourselves, so the next scan
+	 * doesn't trust its time; the slots we touched are dropped from the
+	 * cache by ForgetSlot, since mtime only has a resolution of seconds */
+	mutable bool slotsDirty = true;
 
 public:
 	SaveGameIterator() noexcept = default;
-	~SaveGameIterator() noexcept = default;
+	~SaveGameIterator() noexcept;
 	const charlist& GetSaveGames();
 	void DeleteSaveGame(const Holder<SaveGame>&) const;
 	int CreateSaveGame(Holder<SaveGame>, StringView slotname, bool force = false) const;
 	int CreateSaveGame(int index, bool mqs = false) const;
 	Holder<SaveGame> GetSaveGame(StringView slotname);
+	/** reports the last save once its writer is done, called every frame */
+	void PollSaveWriter() const;
 private:
 	bool RescanSaveGames();
 	static Holder<SaveGame> BuildSaveGame(std::string slotname);
 	void PruneQuickSave(StringView folder) const;
+	void ForgetSlot(const std::string& path) const;
+	void WaitForSaveWriter(bool report = true) const;
+	int CommitSave(std::function<int()> compressor) const;
+	void FinishSave(bool report) const;
 };
 
 }
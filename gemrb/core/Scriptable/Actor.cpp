@@ -42,6 +42,7 @@
 #include "Projectile.h"
 #include "ProjectileServer.h"
 #include "ScriptEngine.h"
+#include "Settings.h"
 #include "Spell.h"
 #include "Sprite2D.h"
 #include "TableMgr.h"
@@ -3640,8 +3641,7 @@ static int CheckInteract(const ieVariable& talker, const ieVariable& target)
 void Actor::HandleInteractV1(const Actor *target)
 {
 	LastTalker = target->GetGlobalID();
-	std::string interAction = fmt::format("Interact(\"{}\")", target->GetScriptName());
-	AddAction(GenerateAction(std::move(interAction)));
+	AddAction(MakeAction(ActionID::Interact).Named(target->GetScriptName()));
 }
 
 int Actor::HandleInteract(const Actor *target) const
@@ -3899,9 +3899,7 @@ void Actor::PlayExistenceSounds()
 			return;
 		}
 
-		unsigned int vol = 100;
-		core->GetDictionary()->Lookup("Volume Ambients", vol);
-		int stream = audio->SetupNewStream(Pos.x, Pos.y, 0, vol, true, 50); // REFERENCE_DISTANCE
+		int stream = audio->SetupNewStream(Pos.x, Pos.y, 0, Settings::VolumeAmbients, true, 50); // REFERENCE_DISTANCE
 		if (stream != -1) {
 			tick_t audioLength = audio->QueueAmbient(stream, sb.Sound);
 			if (audioLength > 0) {
@@ -3931,7 +3929,7 @@ bool Actor::OverrideActions()
 			case 1002:
 			case 1003:
 			case 1005:
-				action = GenerateAction("AttackReevaluate([GOODCUTOFF],10)");
+				action = MakeAction(ActionID::AttackReevaluate).EA(EA_GOODCUTOFF).Int(10);
 				if (action) {
 					AddActionInFront(action);
 					return true;
@@ -3967,11 +3965,11 @@ void Actor::Panic(const Scriptable *attacker, int panicmode)
 		SetBaseBit(IE_STATE_ID, STATE_PANIC, true);
 		break;
 	case PANIC_RANDOMWALK:
-		action = GenerateAction( "RandomWalk()" );
+		action = MakeAction(ActionID::RandomWalk);
 		SetBaseBit(IE_STATE_ID, STATE_PANIC, true);
 		break;
 	case PANIC_BERSERK:
-		action = GenerateAction( "Berserk()" );
+		action = MakeAction(ActionID::Berserk);
 		BaseStats[IE_CHECKFORBERSERK]=3;
 		//SetBaseBit(IE_STATE_ID, STATE_BERSERK, true);
 		break;
@@ -7162,11 +7160,9 @@ void Actor::UpdateActorState()
 
 	// display pc hitpoints if requested
 	// limit the invocation count to save resources (the text is drawn repeatedly anyway)
-	ieDword overheadHP = 0;
-	core->GetDictionary()->Lookup("HP Over Head", overheadHP);
 	assert(game->GameTime);
 	assert(core->Time.round_size);
-	if (overheadHP && Persistent() && (game->GameTime % (core->Time.round_size / 2) == 0)) { // smaller delta to skip fading
+	if (Settings::HPOverHead && Persistent() && (game->GameTime % (core->Time.round_size / 2) == 0)) { // smaller delta to skip fading
 		DisplayHeadHPRatio();
 	}
 
@@ -7273,7 +7269,7 @@ void Actor::UpdateModalState(ieDword gameTime)
 		}
 
 		if (Modified[IE_CHECKFORBERSERK] && !LastTarget && SeeAnyOne(false, false) ) {
-			Action *action = GenerateAction( "Berserk()" );
+			Action *action = MakeAction(ActionID::Berserk);
 			if (action) {
 				ReleaseCurrentAction();
 				AddActionInFront(action);
@@ -7810,8 +7806,7 @@ bool Actor::ShouldDrawCircle() const
 	bool drawcircle = true; // we always show circle/target on pause
 	if (!(gc->GetDialogueFlags() & DF_FREEZE_SCRIPTS)) {
 		// check marker feedback level
-		ieDword markerfeedback = 4;
-		core->GetDictionary()->Lookup("GUI Feedback Level", markerfeedback);
+		ieDword markerfeedback = Settings::GUIFeedbackLevel;
 		if (Selected) {
 			// selected creature
 			drawcircle = markerfeedback >= 2;
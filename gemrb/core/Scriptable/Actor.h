@@ -367,6 +367,7 @@ public:
 	ieDword LastExit = 0;    // the global ID of the exit to be used
 	ieVariable UsedExit; // name of the exit, since global id is not stable after loading a new area
 	ResRef LastArea;
+	const Map* listedIn = nullptr; // the area whose actor list holds us, maintained by Map
 	AnimRef ShieldRef;
 	AnimRef HelmetRef;
 	AnimRef WeaponRef;
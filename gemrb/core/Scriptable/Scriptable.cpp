@@ -37,12 +37,27 @@
 #include "RNG.h"
 #include "Scriptable/InfoPoint.h"
  
+#include <deque>
 #include <utility>
+#include <vector>
 
 namespace GemRB {
 
 // we start this at a non-zero value to make debugging easier
-static ieDword globalActorCounter = 10000;
+static const ieDword firstGlobalID = 10000;
+// globalID - firstGlobalID - 1 holds the registry slot in the low bits and the
+// generation of the slot above them; slots are reused oldest first and every
+// reuse bumps the generation, so a stale id resolves to NULL instead of a newer
+// object. A slot whose generation ran out is retired, so ids are never reused
+static const ieDword globalSlotBits = 20;
+static const ieDword globalSlotMask = (1 << globalSlotBits) - 1;
+static const ieDword globalGenerationMax = (1 << 11) - 1;
+struct GlobalSlot {
+	Scriptable* object;
+	ieDword generation;
+};
+static std::vector<GlobalSlot> globalRegistry;
+static std::deque<ieDword> freeGlobalSlots;
 static bool startActive = false;
 static bool third = false;
 static bool pst_flags = false;
@@ -57,10 +72,19 @@ Scriptable::Scriptable(ScriptableType type)
 	third = core->HasFeature(GF_3ED_RULES);
 	pst_flags = core->HasFeature(GF_PST_STATE_FLAGS);
 
-	globalID = ++globalActorCounter;
-	if (globalActorCounter == 0) {
-		error("Scriptable", "GlobalID overflowed, quitting due to too many actors.");
+	ieDword slot;
+	if (!freeGlobalSlots.empty()) {
+		slot = freeGlobalSlots.front();
+		freeGlobalSlots.pop_front();
+		globalRegistry[slot].object = this;
+	} else {
+		slot = ieDword(globalRegistry.size());
+		if (slot > globalSlotMask) {
+			error("Scriptable", "GlobalID overflowed, quitting due to too many actors.");
+		}
+		globalRegistry.push_back({ this, 0 });
 	}
+	globalID = ((globalRegistry[slot].generation << globalSlotBits) | slot) + firstGlobalID + 1;
 
 	Type = type;
 	if (Type == ST_ACTOR) {
@@ -91,6 +115,26 @@ Scriptable::~Scriptable(void)
 	}
 
 	delete locals;
+	ieDword slot = (globalID - firstGlobalID - 1) & globalSlotMask;
+	GlobalSlot& entry = globalRegistry[slot];
+	entry.object = nullptr;
+	if (entry.generation < globalGenerationMax) {
+		entry.generation++;
+		freeGlobalSlots.push_back(slot);
+	}
+}
+
+Scriptable* Scriptable::GetByGlobalID(ieDword globalID)
+{
+	if (globalID <= firstGlobalID) {
+		return nullptr;
+	}
+	ieDword slot = (globalID - firstGlobalID - 1) & globalSlotMask;
+	ieDword generation = (globalID - firstGlobalID - 1) >> globalSlotBits;
+	if (slot >= globalRegistry.size() || globalRegistry[slot].generation != generation) {
+		return nullptr;
+	}
+	return globalRegistry[slot].object;
 }
 
 void Scriptable::SetScriptName(const ieVariable& text)
@@ -2261,7 +2305,7 @@ void Movable::RandomWalk(bool can_stop, bool run)
 		// a 50/50 chance to move or do a spin (including its own wait)
 		if (RAND(1, 2) == 1) {
 			Action *me = ParamCopy(CurrentAction);
-			Action *turnAction = GenerateAction("RandomTurn()");
+			Action *turnAction = MakeAction(ActionID::RandomTurn);
 			// only spin once before relinquishing control back
 			turnAction->int0Parameter = 3;
 			// remove and readd ourselves, so the turning gets a chance to run
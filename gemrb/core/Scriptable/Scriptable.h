@@ -406,6 +406,8 @@ public:
 	void CastSpellPointEnd(int level, int no_stance);
 	void CastSpellEnd(int level, int no_stance);
 	ieDword GetGlobalID() const { return globalID; }
+	/** resolves a global ID without scanning the areas, NULL if the object is gone */
+	static Scriptable* GetByGlobalID(ieDword globalID);
 	/** timer functions (numeric ID, not saved) */
 	bool TimerActive(ieDword ID);
 	bool TimerExpired(ieDword ID);
@@ -0,0 +1,48 @@
+/* GemRB - Infinity Engine Emulator
+ * Copyright (C) 2003 The GemRB Project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ *
+ */
+
+#include "Settings.h"
+
+#include "Interface.h"
+#include "Variables.h"
+
+namespace GemRB {
+
+unsigned int SettingsGeneration()
+{
+	return core->GetDictionary()->GetGeneration();
+}
+
+bool LookupSetting(const StringView& key, ieDword& value)
+{
+	return core->GetDictionary()->Lookup(key, value);
+}
+
+namespace Settings {
+	const Setting<bool> AlwaysDither("Always Dither", false);
+	const Setting<bool> DuplicateFloatingText("Duplicate Floating Text", false);
+	const Setting<ieDword> GUIFeedbackLevel("GUI Feedback Level", 4);
+	const Setting<bool> HPOverHead("HP Over Head", false);
+	const Setting<int> KeyboardScrollSpeed("Keyboard Scroll Speed", 64);
+	const Setting<unsigned int> VolumeAmbients("Volume Ambients", 100);
+	const Setting<bool> Weather("Weather", true);
+}
+
+}
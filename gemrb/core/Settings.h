@@ -0,0 +1,91 @@
+/* GemRB - Infinity Engine Emulator
+ * Copyright (C) 2003 The GemRB Project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ *
+ */
+
+/**
+ * @file Settings.h
+ * Declares Setting, a typed handle to an option of the game dictionary.
+ * @author The GemRB Project
+ */
+
+#ifndef SETTINGS_H
+#define SETTINGS_H
+
+#include "exports.h"
+#include "ie_types.h"
+
+#include "Strings/StringView.h"
+
+namespace GemRB {
+
+/** generation of the game dictionary, see Variables::GetGeneration */
+GEM_EXPORT unsigned int SettingsGeneration();
+GEM_EXPORT bool LookupSetting(const StringView& key, ieDword& value);
+
+/**
+ * @class Setting
+ * The dictionary stays the backing store (the GUI scripts and the ini
+ * files keep using it), but the value is cached and only looked up again
+ * after something was written to the dictionary.
+ * Like the dictionary itself, handles may only be read on the main thread.
+ */
+
+template <typename T>
+class Setting {
+public:
+	Setting(StringView key, T defaultValue) noexcept
+	: key(key), defaultValue(defaultValue), value(defaultValue) {}
+
+	Setting(const Setting&) = delete;
+	Setting& operator=(const Setting&) = delete;
+
+	operator T() const
+	{
+		unsigned int current = SettingsGeneration();
+		if (!valid || generation != current) {
+			ieDword tmp;
+			value = LookupSetting(key, tmp) ? static_cast<T>(tmp) : defaultValue;
+			generation = current;
+			valid = true;
+		}
+		return value;
+	}
+
+private:
+	StringView key;
+	T defaultValue;
+	mutable T value;
+	mutable unsigned int generation = 0;
+	mutable bool valid = false;
+};
+
+// options that are read on hot paths
+namespace Settings {
+	extern GEM_EXPORT const Setting<bool> AlwaysDither;
+	extern GEM_EXPORT const Setting<bool> DuplicateFloatingText;
+	extern GEM_EXPORT const Setting<ieDword> GUIFeedbackLevel;
+	extern GEM_EXPORT const Setting<bool> HPOverHead;
+	extern GEM_EXPORT const Setting<int> KeyboardScrollSpeed;
+	extern GEM_EXPORT const Setting<unsigned int> VolumeAmbients;
+	extern GEM_EXPORT const Setting<bool> Weather;
+}
+
+}
+
+#endif
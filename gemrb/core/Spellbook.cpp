@@ -30,6 +30,7 @@
 #include "Scriptable/Actor.h"
 
 #include <cstdio>
+#include <cstdlib>
 
 namespace GemRB {
 
@@ -148,6 +149,59 @@ void Spellbook::CopyFrom(const Actor *source)
 	}
 
 	sorcerer = wikipedia.sorcerer;
+	indexStale = true;
+}
+
+void Spellbook::RebuildIndex() const
+{
+	spellIndex.assign(NUM_BOOK_TYPES, SpellIndex());
+	indexStale = false;
+	for (int type = 0; type < NUM_BOOK_TYPES; type++) {
+		for (const auto& spellMemo : spells[type]) {
+			for (const auto& knownSpell : spellMemo->known_spells) {
+				IndexSpell(type, knownSpell->SpellResRef, 1, 0, 0);
+			}
+			for (const auto& memorized : spellMemo->memorized_spells) {
+				IndexSpell(type, memorized->SpellResRef, 0, 1, memorized->Flags ? 1 : 0);
+			}
+		}
+	}
+}
+
+void Spellbook::IndexSpell(int type, const ResRef& name, int known, int memorized, int charged) const
+{
+	// a full rebuild is pending anyway
+	if (indexStale) return;
+
+	SpellCount& byName = spellIndex[type].byName[name];
+	byName.known += known;
+	byName.memorized += memorized;
+	byName.charged += charged;
+
+	SpellCount& byNumber = spellIndex[type].byNumber[atoi(name.c_str() + 4)];
+	byNumber.known += known;
+	byNumber.memorized += memorized;
+	byNumber.charged += charged;
+}
+
+const Spellbook::SpellCount& Spellbook::GetSpellCount(int type, const ResRef& name) const
+{
+	static const SpellCount none;
+	if (indexStale) RebuildIndex();
+
+	const auto& byName = spellIndex[type].byName;
+	auto it = byName.find(name);
+	return it == byName.end() ? none : it->second;
+}
+
+const Spellbook::SpellCount& Spellbook::GetSpellCount(int type, int spellid) const
+{
+	static const SpellCount none;
+	if (indexStale) RebuildIndex();
+
+	const auto& byNumber = spellIndex[type].byNumber;
+	auto it = byNumber.find(spellid);
+	return it == byNumber.end() ? none : it->second;
 }
 
 //ITEM, SPPR, SPWI, SPIN, SPCL
@@ -211,6 +265,9 @@ bool Spellbook::HaveSpell(int spellid, ieDword flags)
 }
 bool Spellbook::HaveSpell(int spellid, int type, ieDword flags)
 {
+	if (!GetSpellCount(type, spellid).charged) return false;
+	if (!(flags & HS_DEPLETE)) return true;
+
 	unsigned int count = GetSpellLevelCount(type);
 	for (unsigned int j = 0; j < count; j++) {
 		const CRESpellMemorization* sm = spells[type][j];
@@ -218,9 +275,7 @@ bool Spellbook::HaveSpell(int spellid, int type, ieDword flags)
 			if (!ms->Flags) continue;
 			if (atoi(ms->SpellResRef.c_str() + 4) != spellid) continue;
 
-			if (!(flags & HS_DEPLETE)) return true;
-
-			if (DepleteSpell(ms) && (sorcerer & (1 << type))) {
+			if (DepleteSpell(ms, type) && (sorcerer & (1 << type))) {
 				DepleteLevel(sm, ms->SpellResRef);
 			}
 			return true;
@@ -246,15 +301,8 @@ int Spellbook::CountSpells(const ResRef& resref, unsigned int type, int flag) co
 	}
 
 	while(i < max) {
-		for (const auto& spellMemo : spells[i]) {
-			for (const auto& spell : spellMemo->memorized_spells) {
-				if (spell->SpellResRef != resref) continue;
-
-				if (flag || spell->Flags) {
-					count++;
-				}
-			}
-		}
+		const SpellCount& sc = GetSpellCount(i, resref);
+		count += flag ? sc.memorized : sc.charged;
 		i++;
 	}
 	return count;
@@ -284,28 +332,15 @@ bool Spellbook::KnowSpell(int spellid) const
 
 bool Spellbook::KnowSpell(int spellid, int type) const
 {
-	for (unsigned int j = 0; j < GetSpellLevelCount(type); j++) {
-		const CRESpellMemorization* sm = spells[type][j];
-		for (const auto& knownSpell : sm->known_spells) {
-			if (atoi(knownSpell->SpellResRef.c_str() + 4) == spellid) {
-				return true;
-			}
-		}
-	}
-	return false;
+	return GetSpellCount(type, spellid).known > 0;
 }
 
 //if resref=="" then it is a knownanyspell
 bool Spellbook::KnowSpell(const ResRef& resref) const
 {
 	for (int i = 0; i < NUM_BOOK_TYPES; i++) {
-		for (const auto& spellMemo : spells[i]) {
-			for (const auto& knownSpell : spellMemo->known_spells) {
-				if (knownSpell->SpellResRef != resref) {
-					continue;
-				}
-				return true;
-			}
+		if (GetSpellCount(i, resref).known) {
+			return true;
 		}
 	}
 	return false;
@@ -315,6 +350,9 @@ bool Spellbook::KnowSpell(const ResRef& resref) const
 bool Spellbook::HaveSpell(const ResRef &resref, ieDword flags)
 {
 	for (int i = 0; i < NUM_BOOK_TYPES; i++) {
+		if (!GetSpellCount(i, resref).charged) continue;
+		if (!(flags & HS_DEPLETE)) return true;
+
 		for (auto& sm : spells[i]) {
 			for (const auto& ms : sm->memorized_spells) {
 				if (!ms->Flags) continue;
@@ -322,10 +360,8 @@ bool Spellbook::HaveSpell(const ResRef &resref, ieDword flags)
 					continue;
 				}
 
-				if (flags&HS_DEPLETE) {
-					if (DepleteSpell(ms) && (sorcerer & (1<<i))) {
-						DepleteLevel(sm, ms->SpellResRef);
-					}
+				if (DepleteSpell(ms, i) && (sorcerer & (1<<i))) {
+					DepleteLevel(sm, ms->SpellResRef);
 				}
 				return true;
 			}
@@ -400,6 +436,7 @@ void Spellbook::RemoveMemorization(CRESpellMemorization* sm, const ResRef& resRe
 			++ms;
 			continue;
 		}
+		IndexSpell(sm->Type, resRef, 0, -1, (*ms)->Flags ? -1 : 0);
 		delete *ms;
 		ms = sm->memorized_spells.erase(ms);
 	}
@@ -413,6 +450,7 @@ bool Spellbook::RemoveSpell(const CREKnownSpell* spell)
 			for (auto ks = spellMemo->known_spells.begin(); ks != spellMemo->known_spells.end(); ++ks) {
 				if (*ks == spell) {
 					ResRef resRef = (*ks)->SpellResRef;
+					IndexSpell(i, resRef, -1, 0, 0);
 					delete *ks;
 					spellMemo->known_spells.erase(ks);
 					RemoveMemorization(spellMemo, resRef);
@@ -449,10 +487,13 @@ void Spellbook::RemoveSpell(int spellid)
 
 void Spellbook::RemoveSpell(int spellid, int type)
 {
+	if (!GetSpellCount(type, spellid).known) return;
+
 	for (const auto& spellMemo : spells[type]) {
 		for (auto ks = spellMemo->known_spells.begin(); ks != spellMemo->known_spells.end(); ++ks) {
 			if (atoi((*ks)->SpellResRef.c_str() + 4) == spellid) {
 				ResRef resRef = (*ks)->SpellResRef;
+				IndexSpell(type, resRef, -1, 0, 0);
 				delete *ks;
 				ks = spellMemo->known_spells.erase(ks);
 				RemoveMemorization(spellMemo, resRef);
@@ -473,6 +514,7 @@ void Spellbook::RemoveSpell(const ResRef& resRef, bool onlyknown)
 					++ks;
 					continue;
 				}
+				IndexSpell(type, resRef, -1, 0, 0);
 				delete *ks;
 				ks = spellMemo->known_spells.erase(ks);
 				if (!onlyknown) RemoveMemorization(spellMemo, resRef);
@@ -549,6 +591,7 @@ bool Spellbook::AddKnownSpell(CREKnownSpell *spl, int flg)
 	}
 
 	spells[type][level]->known_spells.push_back(spl);
+	IndexSpell(type, spl->SpellResRef, 1, 0, 0);
 	if (1 << type == innate || 1 << type == 1 << IE_IWD2_SPELL_SONG || 1 << type == 1 << IE_SPELL_TYPE_SONG) {
 		spells[type][level]->SlotCount++;
 		spells[type][level]->SlotCountWithBonus++;
@@ -610,12 +653,8 @@ unsigned int Spellbook::GetMemorizedSpellsCount(const ResRef& name, int type, bo
 
 	int j = 0;
 	while (t >= 0) {
-		for (const auto& spellMemo : spells[t]) {
-			for (const auto& cms : spellMemo->memorized_spells) {
-				if (cms->SpellResRef != name) continue;
-				if (!real || cms->Flags) j++;
-			}
-		}
+		const SpellCount& sc = GetSpellCount(t, name);
+		j += real ? sc.charged : sc.memorized;
 		if (type >= 0) break;
 		t--;
 	}
@@ -667,7 +706,7 @@ void Spellbook::BonusSpells(int type, int abilityLevel)
 	unsigned int level = GetSpellLevelCount(type);
 	assert(level <= bonuses.size());
 	for (unsigned int i = 0; i < level; i++) {
-		CRESpellMemorization* sm = GetSpellMemorization(type, i);
+		CRESpellMemorization* sm = spells[type][i];
 		// don't give access to new spell levels through these boni
 		if (sm->SlotCountWithBonus) {
 			sm->SlotCountWithBonus += bonuses[i];
@@ -682,13 +721,20 @@ void Spellbook::ClearBonus()
 	for (int type = 0; type < NUM_BOOK_TYPES; type++) {
 		int level = GetSpellLevelCount(type);
 		for (int i = 0; i < level; i++) {
-			CRESpellMemorization* sm = GetSpellMemorization(type, i);
+			CRESpellMemorization* sm = spells[type][i];
 			sm->SlotCountWithBonus=sm->SlotCount;
 		}
 	}
 }
 
 CRESpellMemorization *Spellbook::GetSpellMemorization(unsigned int type, unsigned int level)
+{
+	// the caller may change the page behind our back
+	indexStale = true;
+	return GetSpellPage(type, level);
+}
+
+CRESpellMemorization *Spellbook::GetSpellPage(unsigned int type, unsigned int level)
 {
 	if (type >= (unsigned int)NUM_BOOK_TYPES)
 		return NULL;
@@ -721,7 +767,7 @@ void Spellbook::SetMemorizableSpellsCount(int Value, int type, unsigned int leve
 		return;
 	}
 
-	CRESpellMemorization* sm = GetSpellMemorization(type, level);
+	CRESpellMemorization* sm = GetSpellPage(type, level);
 	if (bonus) {
 		if (!Value) {
 			Value=sm->SlotCountWithBonus;
@@ -762,6 +808,7 @@ bool Spellbook::MemorizeSpell(const CREKnownSpell* spell, bool usable)
 	mem_spl->Flags = usable ? 1 : 0; // FIXME: is it all it's used for?
 
 	sm->memorized_spells.push_back( mem_spl );
+	IndexSpell(spellType, mem_spl->SpellResRef, 0, 1, mem_spl->Flags);
 	ClearSpellInfo();
 	return true;
 }
@@ -772,6 +819,7 @@ bool Spellbook::UnmemorizeSpell(const CREMemorizedSpell* spell)
 		for (const auto& spellMemo : spells[i]) {
 			for (auto s = spellMemo->memorized_spells.begin(); s != spellMemo->memorized_spells.end(); ++s) {
 				if (*s == spell) {
+					IndexSpell(i, spell->SpellResRef, 0, -1, spell->Flags ? -1 : 0);
 					delete *s;
 					spellMemo->memorized_spells.erase(s);
 					ClearSpellInfo();
@@ -802,8 +850,10 @@ bool Spellbook::UnmemorizeSpell(const ResRef& spellRef, bool deplete, uint8_t fl
 				}
 
 				if (deplete) {
+					IndexSpell(type, spellRef, 0, 0, (*s)->Flags ? -1 : 0);
 					(*s)->Flags = 0;
 				} else {
+					IndexSpell(type, spellRef, 0, -1, (*s)->Flags ? -1 : 0);
 					delete *s;
 					sm->memorized_spells.erase(s);
 				}
@@ -851,6 +901,7 @@ void Spellbook::CreateSorcererMemory(int type)
 			delete spellMemo->memorized_spells[cnt];
 		}
 		spellMemo->memorized_spells.clear();
+		indexStale = true;
 		for (const auto& ck : spellMemo->known_spells) {
 			cnt = spellMemo->SlotCountWithBonus;
 			while(cnt--) {
@@ -890,7 +941,7 @@ bool Spellbook::DepleteSpell(int type)
 		const CRESpellMemorization* sm = spells[type][j];
 
 		for (auto& spell : sm->memorized_spells) {
-			if (!DepleteSpell(spell)) continue;
+			if (!DepleteSpell(spell, type)) continue;
 
 			if (sorcerer & (1 << type)) {
 				DepleteLevel(sm, spell->SpellResRef);
@@ -909,6 +960,7 @@ void Spellbook::DepleteLevel(const CRESpellMemorization* sm, const ResRef& excep
 		//sorcerer spells are created in orderly manner
 		if (cms->Flags && last != cms->SpellResRef && except != cms->SpellResRef) {
 			last = cms->SpellResRef;
+			IndexSpell(sm->Type, last, 0, 0, -1);
 			cms->Flags=0;
 		}
 	}
@@ -930,7 +982,7 @@ bool Spellbook::DepleteSpell(int type, unsigned int page, unsigned int slot)
 	}
 
 	CREMemorizedSpell* cms = sm->memorized_spells[slot];
-	ret = DepleteSpell(cms);
+	ret = DepleteSpell(cms, type);
 	if (ret && (sorcerer & (1<<type) ) ) {
 		DepleteLevel (sm, cms->SpellResRef);
 	}
@@ -940,14 +992,17 @@ bool Spellbook::DepleteSpell(int type, unsigned int page, unsigned int slot)
 
 bool Spellbook::ChargeSpell(CREMemorizedSpell* spl)
 {
+	// we don't know the book type here, but recharging is rare
+	if (!spl->Flags) indexStale = true;
 	spl->Flags = 1;
 	ClearSpellInfo();
 	return true;
 }
 
-bool Spellbook::DepleteSpell(CREMemorizedSpell* spl)
+bool Spellbook::DepleteSpell(CREMemorizedSpell* spl, int type)
 {
 	if (spl->Flags) {
+		IndexSpell(type, spl->SpellResRef, 0, 0, -1);
 		spl->Flags = 0;
 		ClearSpellInfo();
 		return true;
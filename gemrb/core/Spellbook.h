@@ -32,6 +32,7 @@
 #include "ie_types.h"
 #include "Resource.h"
 
+#include <unordered_map>
 #include <vector>
 
 namespace GemRB {
@@ -133,13 +134,33 @@ struct SpellExtHeader {
 
 class GEM_EXPORT Spellbook {
 private:
+	struct SpellCount {
+		unsigned int known = 0;
+		unsigned int memorized = 0;
+		unsigned int charged = 0; // memorized and not yet cast
+	};
+	struct SpellIndex {
+		ResRefMap<SpellCount> byName;
+		std::unordered_map<int, SpellCount> byNumber; // the numeric part of the resref
+	};
+
 	std::vector<CRESpellMemorization*> *spells;
 	std::vector<SpellExtHeader*> spellinfo;
+	// per book type spell counts, so the script queries don't have to walk all the pages
+	mutable std::vector<SpellIndex> spellIndex;
+	mutable bool indexStale = true;
 	int sorcerer = 0;
 	int innate;
 
+	/** returns the counts for a spell of a book type, rebuilding the index if needed */
+	const SpellCount& GetSpellCount(int type, const ResRef& name) const;
+	const SpellCount& GetSpellCount(int type, int spellid) const;
+	/** adjusts the index after a single spell changed */
+	void IndexSpell(int type, const ResRef& name, int known, int memorized, int charged) const;
+	void RebuildIndex() const;
+
 	/** Sets spell from memorized as 'already-cast' */
-	bool DepleteSpell(CREMemorizedSpell* spl);
+	bool DepleteSpell(CREMemorizedSpell* spl, int type);
 	/** Depletes a sorcerer type spellpage by one */
 	void DepleteLevel(const CRESpellMemorization* sm, const ResRef& except) const;
 	/** Adds a single spell to the spell info list */
@@ -152,6 +173,8 @@ private:
 	void RemoveMemorization(CRESpellMemorization* sm, const ResRef& resRef);
 	/** adds a spell to the book, internal */
 	bool AddKnownSpell(CREKnownSpell *spl, int memo);
+	/** returns a page, creating it if needed, without invalidating the index */
+	CRESpellMemorization* GetSpellPage(unsigned int type, unsigned int level);
 	/** Adds a new CRESpellMemorization, to the *end* only */
 	bool AddSpellMemorization(CRESpellMemorization* sm);
 
@@ -0,0 +1,179 @@
+/* GemRB - Infinity Engine Emulator
+ * Copyright (C) 2003 The GemRB Project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ *
+ */
+
+/**
+ * @file BinaryView.h
+ * Declares BinaryView, a reader for fixed size records of a stream.
+ * @author The GemRB Project
+ */
+
+#ifndef BINARYVIEW_H
+#define BINARYVIEW_H
+
+#include "DataStream.h"
+
+#include <cassert>
+#include <cstring>
+#include <vector>
+
+namespace GemRB {
+
+/**
+ * @class BinaryView
+ * Takes the next len bytes of a stream in one go and parses them without
+ * going through the virtual stream interface for every field.
+ * Memory backed streams are read in place, others are copied once.
+ * It offers the same reading calls as DataStream, so the ReadWord etc.
+ * macros work on it too. _DEBUG builds read every field from the stream
+ * as well and assert that both decode the same.
+ */
+
+class BinaryView {
+public:
+	BinaryView(DataStream* stream, strpos_t len)
+	: swap(stream->NeedEndianSwap())
+	{
+#ifdef _DEBUG
+		this->stream = stream;
+		start = stream->GetPos();
+#endif
+		if (len > stream->Remains()) {
+			len = stream->Remains();
+		}
+		data = stream->MapData(len);
+		if (!data) {
+			buffer.resize(len);
+			strret_t read = stream->Read(buffer.data(), len);
+			len = read > 0 ? read : 0;
+			data = buffer.data();
+		}
+		size = len;
+	}
+
+	BinaryView(const BinaryView&) = delete;
+	BinaryView& operator=(const BinaryView&) = delete;
+
+	strret_t Read(void* dest, strpos_t len) {
+		if (pos + len > size) {
+			return DataStream::Error;
+		}
+		memcpy(dest, data + pos, len);
+		pos += len;
+#ifdef _DEBUG
+		std::vector<char> check(len);
+		CheckField(pos - len, [&]() { return stream->Read(check.data(), len); });
+		assert(memcmp(check.data(), dest, len) == 0);
+#endif
+		return len;
+	}
+
+	template <typename T>
+	strret_t ReadScalar(T& dest) {
+		strret_t len = Read(&dest, sizeof(T));
+		if (swap) {
+			swabs(&dest, sizeof(T));
+		}
+#ifdef _DEBUG
+		if (len != DataStream::Error) {
+			T check {};
+			CheckField(pos - sizeof(T), [&]() { return stream->ReadScalar(check); });
+			assert(memcmp(&check, &dest, sizeof(T)) == 0);
+		}
+#endif
+		return len;
+	}
+
+	template <typename DST, typename SRC>
+	strret_t ReadScalar(DST& dest) {
+		static_assert(sizeof(DST) >= sizeof(SRC), "This flavor of ReadScalar requires DST to be >= SRC.");
+		SRC src;
+		strret_t len = ReadScalar(src);
+		dest = src; // preserve sign extension
+		return len;
+	}
+
+	template <typename ENUM>
+	typename std::enable_if<std::is_enum<ENUM>::value, strret_t>::type
+	ReadEnum(ENUM& dest) {
+		typename std::underlying_type<ENUM>::type scalar;
+		strret_t ret = ReadScalar(scalar);
+		dest = static_cast<ENUM>(scalar);
+		return ret;
+	}
+
+	template <typename STR>
+	strret_t ReadRTrimString(STR& dest, size_t len) {
+		strret_t read = Read(dest.begin(), len);
+		RTrim(dest);
+		return read;
+	}
+
+	strret_t ReadPoint(Point& p) {
+		// in the data files Points are 16bit per coord as opposed to our 32ish
+		strret_t ret = ReadScalar<int, ieWord>(p.x);
+		ret += ReadScalar<int, ieWord>(p.y);
+		return ret;
+	}
+
+	strret_t ReadRegion(Region& r) {
+		strret_t ret = ReadScalar<int, ieWord>(r.x);
+		ret += ReadScalar<int, ieWord>(r.y);
+		ret += ReadScalar<int, ieWord>(r.w);
+		ret += ReadScalar<int, ieWord>(r.h);
+		return ret;
+	}
+
+	/** only GEM_CURRENT_POS and GEM_STREAM_START (of the view) are supported */
+	stroff_t Seek(stroff_t offset, strpos_t startpos) {
+		strpos_t newpos = startpos == GEM_STREAM_START ? offset : pos + offset;
+		if (newpos > size) {
+			return DataStream::InvalidPos;
+		}
+		pos = newpos;
+		return 0;
+	}
+
+	strpos_t GetPos() const { return pos; }
+	strpos_t Remains() const { return size - pos; }
+
+private:
+#ifdef _DEBUG
+	// reads the field at offset (of the view) the old way, from the stream
+	template <typename READ>
+	void CheckField(strpos_t offset, READ read) const {
+		strpos_t resume = stream->GetPos();
+		stream->Seek(start + offset, GEM_STREAM_START);
+		read();
+		stream->Seek(resume, GEM_STREAM_START);
+	}
+
+	DataStream* stream = nullptr;
+	strpos_t start = 0;
+#endif
+	const char* data = nullptr;
+	std::vector<char> buffer;
+	strpos_t size = 0;
+	strpos_t pos = 0;
+	bool swap = false;
+};
+
+}
+
+#endif
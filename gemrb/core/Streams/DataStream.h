@@ -172,6 +172,9 @@ public:
 	strret_t ReadRegion(Region&);
 	
 	virtual stroff_t Seek(stroff_t pos, strpos_t startpos) = 0;
+	/** Returns the next len bytes in place and skips them, if the stream
+	 * is memory backed; otherwise nothing happens and NULL is returned */
+	virtual const char* MapData(strpos_t /*len*/) { return nullptr; }
 	strpos_t Remains() const;
 	strpos_t Size() const;
 	strpos_t GetPos() const;
@@ -192,6 +195,7 @@ protected:
 	bool IsDataBigEndian = false;
 	
 private:
+	friend class BinaryView;
 	bool NeedEndianSwap() const noexcept;
 
 	bool IsCPUBigEndian = false;
@@ -21,6 +21,7 @@
 #include "FileStream.h"
 
 #include "Interface.h"
+#include "ResourceManager.h"
 
 namespace GemRB {
 
@@ -47,11 +48,12 @@ DataStream* FileStream::Clone() const noexcept
 	return OpenFile(originalfile);
 }
 
-void FileStream::Close()
+bool FileStream::Close()
 {
-	str = File();
+	bool closed = str.Close();
 	opened = false;
 	created = false;
+	return closed;
 }
 
 void FileStream::FindLength()
@@ -121,6 +123,8 @@ bool FileStream::Create(const char *path)
 	if (!str.OpenNew(originalfile)) {
 		return false;
 	}
+	// the new file may be a resource the managers recorded as missing
+	ResourceManager::ForgetResource(originalfile);
 	opened = true;
 	created = true;
 	Pos = 0;
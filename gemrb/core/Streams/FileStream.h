@@ -55,6 +55,13 @@ public:
 	~File() {
 		if (file) fclose(file);
 	}
+
+	/** returns false if flushing the buffered writes failed */
+	bool Close() {
+		FILE* f = file;
+		file = nullptr;
+		return !f || fclose(f) == 0;
+	}
 	
 	File& operator=(const File&) = delete;
 	File& operator=(File&& f) noexcept {
@@ -118,7 +125,8 @@ public:
 	strret_t Write(const void* src, strpos_t length) override;
 	strret_t Seek(stroff_t pos, strpos_t startpos) override;
 
-	void Close();
+	/** returns false if pending writes could not be flushed */
+	bool Close();
 public:
 	/** Opens the specifed file.
 	 *
@@ -73,6 +73,18 @@ strret_t MemoryStream::Write(const void* src, strpos_t length)
 	return length;
 }
 
+const char* MemoryStream::MapData(strpos_t length)
+{
+	// encrypted data has to be decoded on the way out
+	if (!data || Encrypted || Pos + length > size) {
+		return nullptr;
+	}
+
+	const char* mapped = data + Pos;
+	Pos += length;
+	return mapped;
+}
+
 stroff_t MemoryStream::Seek(stroff_t newpos, strpos_t type)
 {
 	switch (type) {
@@ -180,6 +180,7 @@ void Variables::RemoveAll(ReleaseFun fun)
 		p = pNext;
 	}
 	m_pBlocks = NULL;
+	m_nGeneration++;
 }
 
 Variables::~Variables()
@@ -364,6 +365,7 @@ void Variables::SetAtCString(const key_t& key, const char* str)
 		pAssoc->Value.sValue = strdup(str);
 		pAssoc->nHashValue = nHash;
 	}
+	m_nGeneration++;
 }
 
 void Variables::SetAt(const key_t& key, void* value)
@@ -393,6 +395,7 @@ void Variables::SetAt(const key_t& key, void* value)
 		pAssoc->Value.pValue = value;
 		pAssoc->nHashValue = nHash;
 	}
+	m_nGeneration++;
 
 }
 
@@ -425,6 +428,7 @@ void Variables::SetAt(const key_t& key, ieDword value, bool nocreate)
 		pAssoc->Value.nValue = value;
 		pAssoc->nHashValue = nHash;
 	}
+	m_nGeneration++;
 }
 
 void Variables::Remove(const key_t& key)
@@ -452,6 +456,7 @@ void Variables::Remove(const key_t& key)
 	}
 	pAssoc->pNext = 0;
 	FreeAssoc(pAssoc);
+	m_nGeneration++;
 }
 
 void Variables::LoadInitialValues(const ResRef& name)
@@ -90,6 +90,11 @@ public:
 	{
 		return m_nCount == 0;
 	}
+	// changes on every write, so readers can tell when to look again
+	inline unsigned int GetGeneration() const
+	{
+		return m_nGeneration;
+	}
 
 	bool Lookup(const key_t&, ieDword& rValue) const;
 	bool Lookup(const key_t&, String& dest) const;
@@ -148,6 +153,7 @@ protected:
 	MemBlock* m_pBlocks;
 	int m_nBlockSize;
 	int m_type; //could be string or ieDword 
+	unsigned int m_nGeneration = 0;
 
 	Variables::MyAssoc* NewAssoc(const key_t&);
 	void FreeAssoc(Variables::MyAssoc*);
@@ -330,6 +330,24 @@ static Color ApplyFlagsForColor(const Color& inCol, BlitFlags& flags)
 	return outC;
 }
 
+// the batched calls only need a copy of the colors if a flag actually changes them
+static const std::vector<Color>& ApplyFlagsForColors(const std::vector<Color>& inCols, BlitFlags& flags)
+{
+	static std::vector<Color> s_colors;
+
+	bool halftrans = flags & BlitFlags::HALFTRANS;
+	ApplyFlagsForColor(Color(), flags);
+	if (!halftrans) {
+		return inCols;
+	}
+
+	s_colors = inCols;
+	for (auto& c : s_colors) {
+		c.a = 128;
+	}
+	return s_colors;
+}
+
 void Video::DrawRect(const Region& rgn, const Color& color, bool fill, BlitFlags flags)
 {
 	Color c = ApplyFlagsForColor(color, flags);
@@ -348,12 +366,30 @@ void Video::DrawPoints(const std::vector<Point>& points, const Color& color, Bli
 	DrawPointsImp(points, c, flags);
 }
 
+void Video::DrawPoints(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	assert(points.size() == colors.size());
+	if (points.empty()) return;
+
+	const std::vector<Color>& c = ApplyFlagsForColors(colors, flags);
+	DrawPointsImp(points, c, flags);
+}
+
 void Video::DrawCircle(const Point& origin, unsigned short r, const Color& color, BlitFlags flags)
 {
 	Color c = ApplyFlagsForColor(color, flags);
 	DrawCircleImp(origin, r, c, flags);
 }
 
+void Video::DrawCircles(const std::vector<Point>& origins, unsigned short r, const std::vector<Color>& colors, BlitFlags flags)
+{
+	assert(origins.size() == colors.size());
+	if (origins.empty()) return;
+
+	const std::vector<Color>& c = ApplyFlagsForColors(colors, flags);
+	DrawCirclesImp(origins, r, c, flags);
+}
+
 void Video::DrawEllipseSegment(const Point& origin, unsigned short xr, unsigned short yr, const Color& color,
 								double anglefrom, double angleto, bool drawlines, BlitFlags flags)
 {
@@ -388,4 +424,13 @@ void Video::DrawLines(const std::vector<Point>& points, const Color& color, Blit
 	DrawLinesImp(points, c, flags);
 }
 
+void Video::DrawLineSegments(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	assert(points.size() == colors.size() * 2);
+	if (colors.empty()) return;
+
+	const std::vector<Color>& c = ApplyFlagsForColors(colors, flags);
+	DrawLineSegmentsImp(points, c, flags);
+}
+
 }
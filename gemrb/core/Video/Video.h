@@ -130,6 +130,10 @@ private:
 	virtual void DrawPolygonImp(const Gem_Polygon* poly, const Point& origin, const Color& color, bool fill, BlitFlags flags) = 0;
 	virtual void DrawLineImp(const Point& p1, const Point& p2, const Color& color, BlitFlags flags) = 0;
 	virtual void DrawLinesImp(const std::vector<Point>& points, const Color& color, BlitFlags flags)=0;
+	// batched variants: one color per point / circle / segment so callers can submit everything in one go
+	virtual void DrawPointsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) = 0;
+	virtual void DrawCirclesImp(const std::vector<Point>& origins, unsigned short r, const std::vector<Color>& colors, BlitFlags flags) = 0;
+	virtual void DrawLineSegmentsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) = 0;
 
 public:
 	Video() noexcept;
@@ -177,6 +181,9 @@ public:
 
 	virtual void BlitVideoBuffer(const VideoBufferPtr& buf, const Point& p, BlitFlags flags,
 								 Color tint = Color()) = 0;
+	/** false if blending into a buffer with alpha leaves the blended pixels opaque,
+	 *  translucent layers then have to be drawn directly */
+	virtual bool BlendsIntoAlphaBuffers() const { return true; }
 
 	/** Return GemRB window screenshot.
 	 * It's generated from the momentary back buffer */
@@ -186,9 +193,14 @@ public:
 
 	void DrawPoint(const Point&, const Color& color, BlitFlags flags = BlitFlags::NONE);
 	void DrawPoints(const std::vector<Point>& points, const Color& color, BlitFlags flags = BlitFlags::NONE);
+	/** Draws a batch of points, points[i] is drawn with colors[i]
+	 *  callers should keep equal colors adjacent, since drivers can then submit them together */
+	void DrawPoints(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags = BlitFlags::NONE);
 
 	/** Draws a circle */
 	void DrawCircle(const Point& origin, unsigned short r, const Color& color, BlitFlags flags = BlitFlags::NONE);
+	/** Draws a batch of circles of the same radius, origins[i] is drawn with colors[i] */
+	void DrawCircles(const std::vector<Point>& origins, unsigned short r, const std::vector<Color>& colors, BlitFlags flags = BlitFlags::NONE);
 	/** Draws an Ellipse Segment */
 	void DrawEllipseSegment(const Point& origin, unsigned short xr, unsigned short yr, const Color& color,
 									double anglefrom, double angleto, bool drawlines = true, BlitFlags flags = BlitFlags::NONE);
@@ -199,6 +211,9 @@ public:
 	/** Draws a line segment */
 	void DrawLine(const Point& p1, const Point& p2, const Color& color, BlitFlags flags = BlitFlags::NONE);
 	void DrawLines(const std::vector<Point>& points, const Color& color, BlitFlags flags = BlitFlags::NONE);
+	/** Draws a batch of unconnected line segments, points are consumed in pairs
+	 *  and the segment from points[2*i] to points[2*i+1] is drawn with colors[i] */
+	void DrawLineSegments(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags = BlitFlags::NONE);
 	/** Sets Event Manager */
 	void SetEventMgr(EventMgr* evnt);
 
@@ -37,8 +37,37 @@ bool p2DAImporter::Open(DataStream* str)
 	}
 	str->CheckEncrypted();
 
+	// take the whole table in one go, DataStream::ReadLine reads byte by byte
+	std::string text(str->Remains(), '\0');
+	if (!text.empty() && str->Read(&text[0], text.size()) == DataStream::Error) {
+		text.clear();
+	}
+	size_t textPos = 0;
+	// same rules as ReadLine: tabs are spaces and carriage returns are dropped
+	auto ReadLine = [&](std::string& buf) -> bool {
+		if (textPos >= text.size()) {
+			return false;
+		}
+		size_t end = text.find('\n', textPos);
+		if (end == std::string::npos) {
+			end = text.size();
+		}
+		buf.clear();
+		for (size_t i = textPos; i < end; ++i) {
+			char ch = text[i];
+			if (ch == '\t') {
+				ch = ' ';
+			}
+			if (ch != '\r') {
+				buf.push_back(ch);
+			}
+		}
+		textPos = end + 1;
+		return true;
+	};
+
 	std::string line;
-	str->ReadLine(line);
+	ReadLine(line);
 	LTrim(line);
 	if (line.compare(0, 8, "2DA V1.0") != 0) {
 		Log(WARNING, "2DAImporter", "Bad signature ({})! Complaining, but not ignoring...", str->filename);
@@ -46,7 +75,7 @@ bool p2DAImporter::Open(DataStream* str)
 		// also, certain creatures are described by 2da's without signature.
 		// return false;
 	}
-	str->ReadLine(line);
+	ReadLine(line);
 	auto pos = line.find_first_of(' ');
 	if (pos != std::string::npos) {
 		defVal = line.substr(0, pos);
@@ -55,7 +84,7 @@ bool p2DAImporter::Open(DataStream* str)
 	}
 	
 	auto NextLine = [&]() -> bool {
-		while (str->ReadLine(line) != DataStream::Error) {
+		while (ReadLine(line)) {
 			if (line[0] != '#') { // allow comments
 				return true;
 			}
@@ -43,6 +43,7 @@
 #include "Scriptable/Container.h"
 #include "Scriptable/Door.h"
 #include "Scriptable/InfoPoint.h"
+#include "Streams/BinaryView.h"
 #include "Streams/FileStream.h"
 #include "Streams/SlicedStream.h"
 
@@ -260,8 +261,11 @@ static TileProps MakeTileProps(const TileMap* tm, const ResRef& wedref, bool day
 
 bool AREImporter::Import(DataStream* str)
 {
+	// the fixed header is parsed from a single view instead of the stream,
+	// the view starts at the signature, so the offsets are file offsets
+	BinaryView header(str, 0x11c + 16);
 	char Signature[8];
-	str->Read( Signature, 8 );
+	header.Read( Signature, 8 );
 
 	if (strncmp( Signature, "AREAV1.0", 8 ) != 0) {
 		if (strncmp( Signature, "AREAV9.1", 8 ) != 0) {
@@ -273,22 +277,22 @@ bool AREImporter::Import(DataStream* str)
 		bigheader = 0;
 	}
 	//TEST VERSION: SKIPPING VALUES
-	str->ReadResRef( WEDResRef );
-	str->ReadDword(LastSave);
-	str->ReadDword(AreaFlags);
+	header.ReadResRef( WEDResRef );
+	header.ReadDword(LastSave);
+	header.ReadDword(AreaFlags);
 	//skipping bg1 area connection fields
-	str->Seek( 0x48, GEM_STREAM_START );
-	str->ReadEnum<MapEnv>(AreaType);
-	str->ReadWord(WRain);
-	str->ReadWord(WSnow);
-	str->ReadWord(WFog);
-	str->ReadWord(WLightning);
+	header.Seek( 0x48, GEM_STREAM_START );
+	header.ReadEnum<MapEnv>(AreaType);
+	header.ReadWord(WRain);
+	header.ReadWord(WSnow);
+	header.ReadWord(WFog);
+	header.ReadWord(WLightning);
 	// unused wind speed, TODO: EEs use it for transparency
 	// a single byte was re-purposed to control the alpha on the stencil water for more or less transparency.
 	// If you set it to 0, then the water should be appropriately 50% transparent.
 	// If you set it to any other number, it will be that transparent.
 	// It's 1 byte, so setting it to 128 you'll have the same as the default of 0
-	str->ReadWord(WUnknown);
+	header.ReadWord(WUnknown);
 
 	AreaDifficulty = 0;
 	if (bigheader) {
@@ -297,12 +301,12 @@ bool AREImporter::Import(DataStream* str)
 		AreaDifficulty = 1;
 		ieByte tmp = 0;
 		int avgPartyLevel = core->GetGame()->GetTotalPartyLevel(false) / core->GetGame()->GetPartySize(false);
-		str->Read(&tmp, 1); // 0x54
+		header.Read(&tmp, 1); // 0x54
 		if (tmp && avgPartyLevel >= tmp) {
 			AreaDifficulty = 2;
 		}
 		tmp = 0;
-		str->Read(&tmp, 1); // 0x55
+		header.Read(&tmp, 1); // 0x55
 		if (tmp && avgPartyLevel >= tmp) {
 			AreaDifficulty = 4;
 		}
@@ -310,47 +314,47 @@ bool AREImporter::Import(DataStream* str)
 		// but we resolve everything here and store AreaDifficulty instead
 	}
 	//bigheader gap is here
-	str->Seek( 0x54 + bigheader, GEM_STREAM_START );
-	str->ReadDword(ActorOffset);
-	str->ReadWord(ActorCount);
-	str->ReadWord(InfoPointsCount);
-	str->ReadDword(InfoPointsOffset);
-	str->ReadDword(SpawnOffset);
-	str->ReadDword(SpawnCount);
-	str->ReadDword(EntrancesOffset);
-	str->ReadDword(EntrancesCount);
-	str->ReadDword(ContainersOffset);
-	str->ReadWord(ContainersCount);
-	str->ReadWord(ItemsCount);
-	str->ReadDword(ItemsOffset);
-	str->ReadDword(VerticesOffset);
-	str->ReadWord(VerticesCount);
-	str->ReadWord(AmbiCount);
-	str->ReadDword(AmbiOffset);
-	str->ReadDword(VariablesOffset);
-	str->ReadDword(VariablesCount);
+	header.Seek( 0x54 + bigheader, GEM_STREAM_START );
+	header.ReadDword(ActorOffset);
+	header.ReadWord(ActorCount);
+	header.ReadWord(InfoPointsCount);
+	header.ReadDword(InfoPointsOffset);
+	header.ReadDword(SpawnOffset);
+	header.ReadDword(SpawnCount);
+	header.ReadDword(EntrancesOffset);
+	header.ReadDword(EntrancesCount);
+	header.ReadDword(ContainersOffset);
+	header.ReadWord(ContainersCount);
+	header.ReadWord(ItemsCount);
+	header.ReadDword(ItemsOffset);
+	header.ReadDword(VerticesOffset);
+	header.ReadWord(VerticesCount);
+	header.ReadWord(AmbiCount);
+	header.ReadDword(AmbiOffset);
+	header.ReadDword(VariablesOffset);
+	header.ReadDword(VariablesCount);
 	ieDword tmp; // unused TiledObjectFlagCount and TiledObjectFlagOffset
-	str->ReadDword(tmp);
-	str->ReadResRef( Script );
-	str->ReadDword(ExploredBitmapSize);
-	str->ReadDword(ExploredBitmapOffset);
-	str->ReadDword(DoorsCount);
-	str->ReadDword(DoorsOffset);
-	str->ReadDword(AnimCount);
-	str->ReadDword(AnimOffset);
-	str->ReadDword(TileCount);
-	str->ReadDword(TileOffset);
-	str->ReadDword(SongHeader);
-	str->ReadDword(RestHeader);
+	header.ReadDword(tmp);
+	header.ReadResRef( Script );
+	header.ReadDword(ExploredBitmapSize);
+	header.ReadDword(ExploredBitmapOffset);
+	header.ReadDword(DoorsCount);
+	header.ReadDword(DoorsOffset);
+	header.ReadDword(AnimCount);
+	header.ReadDword(AnimOffset);
+	header.ReadDword(TileCount);
+	header.ReadDword(TileOffset);
+	header.ReadDword(SongHeader);
+	header.ReadDword(RestHeader);
 	if (core->HasFeature(GF_AUTOMAP_INI) ) {
-		str->ReadDword(tmp); //skipping unknown in PST
-	}
-	str->ReadDword(NoteOffset);
-	str->ReadDword(NoteCount);
-	str->ReadDword(TrapOffset);
-	str->ReadDword(TrapCount);
-	str->ReadResRef( Dream1 );
-	str->ReadResRef( Dream2 );
+		header.ReadDword(tmp); //skipping unknown in PST
+	}
+	header.ReadDword(NoteOffset);
+	header.ReadDword(NoteCount);
+	header.ReadDword(TrapOffset);
+	header.ReadDword(TrapCount);
+	header.ReadResRef( Dream1 );
+	header.ReadResRef( Dream2 );
 	// 56 bytes of reserved space
 	return true;
 }
@@ -59,6 +59,7 @@ static const int ff_wma_critical_freqs[25] = {
 BIKPlayer::BIKPlayer() noexcept
 {
 	movieFormat = Video::BufferFormat::YV12;
+	decodeAhead = true;
 }
 
 BIKPlayer::~BIKPlayer(void)
@@ -188,6 +189,8 @@ bool BIKPlayer::Import(DataStream* str)
 		if (validVideo) {
 			movieSize.w = header.width;
 			movieSize.h = header.height;
+			// quick hack, we should rather use the rational time base as ffmpeg
+			frame_wait = microseconds(v_timebase.num * 1000000 / v_timebase.den);
 			framePos = 0;
 			sound_init( core->GetAudioDrv()->CanPlay());
 			return video_init() == 0;
@@ -202,10 +205,6 @@ bool BIKPlayer::DecodeFrame(VideoBuffer& buf)
 		return false;
 	}
 
-	if (lastTime > seconds(0)) {
-		// quick hack, we should rather use the rational time base as ffmpeg
-		timer_wait(microseconds(v_timebase.num * 1000000 / v_timebase.den));
-	}
 	if(framePos >= header.framecount) {
 		return false;
 	}
@@ -222,10 +221,6 @@ bool BIKPlayer::DecodeFrame(VideoBuffer& buf)
 		//buggy frame, we stop immediately
 		return false;
 	}
-	if (lastTime == seconds(0)) {
-		timer_start();
-	}
-
 	return true;
 }
 
@@ -1437,19 +1432,14 @@ int BIKPlayer::DecodeVideoFrame(void *data, int data_size, VideoBuffer& buf)
 		v_gb.get_bits_align32();
 	}
 
-	if (video_frameskip) {
-		video_frameskip--;
-		video_skippedframes++;
-	} else {
-		const Size& bufsize = buf.Size();
-		int dest_x = unsigned(bufsize.w - header.width) >> 1;
-		int dest_y = unsigned(bufsize.h - header.height) >> 1;
-
-		buf.CopyPixels(Region(dest_x, dest_y, header.width, header.height),
-					   c_pic->data[0], &c_pic->linesize[0], // Y
-					   c_pic->data[1], &c_pic->linesize[1], // U
-					   c_pic->data[2], &c_pic->linesize[2]);// V
-	}
+	const Size& bufsize = buf.Size();
+	int dest_x = unsigned(bufsize.w - header.width) >> 1;
+	int dest_y = unsigned(bufsize.h - header.height) >> 1;
+
+	buf.CopyPixels(Region(dest_x, dest_y, header.width, header.height),
+				   c_pic->data[0], &c_pic->linesize[0], // Y
+				   c_pic->data[1], &c_pic->linesize[1], // U
+				   c_pic->data[2], &c_pic->linesize[2]);// V
 
 	std::swap(c_pic, c_last);
 	return 0;
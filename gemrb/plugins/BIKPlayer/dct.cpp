@@ -37,6 +37,18 @@ av_cold int ff_dct_init(DCTContext *s, int nbits, int inverse)
     if (!s->data)
         return -1;
 
+    /* the angles only depend on the size, so don't redo the trigonometry per call */
+#define ROTATE(i,n) (-M_PI*((n)-0.5f)*(i)/(n))
+    s->rot_cos = (double *) av_malloc(sizeof(double) * 2 * n);
+    s->rot_sin = (double *) av_malloc(sizeof(double) * 2 * n);
+    if (!s->rot_cos || !s->rot_sin)
+        return -1;
+    for (int i = 0; i < 2 * n; i++) {
+        s->rot_cos[i] = std::cos(ROTATE(i, n));
+        s->rot_sin[i] = std::sin(ROTATE(i, n));
+    }
+#undef ROTATE
+
     if (ff_fft_init(&s->fft, nbits+1, inverse) < 0)
         return -1;
 
@@ -47,18 +59,19 @@ static void ff_dct_calc_c(DCTContext *s, FFTSample *data)
 {
     int n = 1<<s->nbits;
     int i;
+    const double *rot_cos = s->rot_cos;
+    const double *rot_sin = s->rot_sin;
 
-#define ROTATE(i,n) (-M_PI*((n)-0.5f)*(i)/(n))
     if (s->inverse) {
         for(i=0; i < n; i++) {
-            s->data[i].re = (float) (2 * data[i] * std::cos(ROTATE(i, n)));
-            s->data[i].im = (float) (2 * data[i] * std::sin(ROTATE(i, n)));
+            s->data[i].re = (float) (2 * data[i] * rot_cos[i]);
+            s->data[i].im = (float) (2 * data[i] * rot_sin[i]);
         }
         s->data[n].re = 0;
         s->data[n].im = 0;
         for(i=0; i<n-1; i++) {
-            s->data[n+i+1].re = (float) (-2 * data[n - (i + 1)] * std::cos(ROTATE(n + i + 1, n)));
-            s->data[n+i+1].im = (float) (-2 * data[n - (i + 1)] * std::sin(ROTATE(n + i + 1, n)));
+            s->data[n+i+1].re = (float) (-2 * data[n - (i + 1)] * rot_cos[n + i + 1]);
+            s->data[n+i+1].im = (float) (-2 * data[n - (i + 1)] * rot_sin[n + i + 1]);
         }
     }else{
         for(i=0; i < n; i++) {
@@ -77,9 +90,8 @@ static void ff_dct_calc_c(DCTContext *s, FFTSample *data)
             data[i] = s->data[n-(i+1)].re / (2 * n);
     }else {
         for(i=0; i < n; i++)
-            data[i] =  (float) (s->data[i].re / (2 * std::cos(ROTATE(i, n))));
+            data[i] =  (float) (s->data[i].re / (2 * rot_cos[i]));
     }
-#undef ROTATE
 }
 
 void ff_dct_calc(DCTContext *s, FFTSample *data)
@@ -91,4 +103,6 @@ av_cold void ff_dct_end(DCTContext *s)
 {
     ff_fft_end(&s->fft);
     av_freep((void **) &s->data);
+    av_freep((void **) &s->rot_cos);
+    av_freep((void **) &s->rot_sin);
 }
@@ -148,6 +148,15 @@ extern SINTABLE(65536);
 int ff_fft_init(FFTContext *s, int nbits, int inverse);
 void ff_fft_permute_c(FFTContext *s, FFTComplex *z);
 void ff_fft_calc_c(const FFTContext *s, FFTComplex *z);
+void ff_fft_calc_simd(const FFTContext *s, FFTComplex *z);
+
+/**
+ * SSE2/NEON versions of the transforms are chosen in the *_init functions
+ * when the cpu has them. They give bit-identical results to the C code;
+ * clearing ff_simd_allowed before init forces the C versions.
+ */
+extern int ff_simd_allowed;
+int ff_simd_supported(void);
 
 /**
  * Do the permutation needed BEFORE calling ff_fft_calc().
@@ -198,6 +207,7 @@ typedef struct {
     FFTSample *tcos;
     FFTSample *tsin;
     FFTContext fft;
+    int simd;
 } RDFTContext;
 
 /**
@@ -215,6 +225,9 @@ typedef struct {
     int nbits;
     int inverse;
     FFTComplex *data;
+    /* cos/sin of the rotation angles, 2n entries, computed once at init */
+    double *rot_cos;
+    double *rot_sin;
     FFTContext fft;
 } DCTContext;
 
@@ -27,6 +27,7 @@
  */
 
 #include "dsputil.h"
+#include "simd.h"
 
 #include <cmath>
 
@@ -97,7 +98,7 @@ av_cold int ff_fft_init(FFTContext *s, int nbits, int inverse)
     s2 = (float) (inverse ? 1.0 : -1.0);
 
     s->fft_permute = ff_fft_permute_c;
-    s->fft_calc    = ff_fft_calc_c;
+    s->fft_calc    = ff_simd_supported() ? ff_fft_calc_simd : ff_fft_calc_c;
     s->exptab1     = NULL;
     s->split_radix = 1;
 
@@ -354,3 +355,105 @@ void ff_fft_calc_c(const FFTContext *s, FFTComplex *z)
     fft_dispatch[s->nbits-2](z);
 }
 
+int ff_simd_allowed = 1;
+
+int ff_simd_supported(void)
+{
+#if HAVE_SIMD && defined(__GNUC__) && defined(__x86_64__)
+    return ff_simd_allowed && __builtin_cpu_supports("sse2");
+#else
+    return ff_simd_allowed && HAVE_SIMD;
+#endif
+}
+
+#if HAVE_SIMD
+/* pass() on four consecutive elements at once, element k uses wre[k] and wim[-k] */
+static void pass_simd(FFTComplex *z, const FFTSample *wre, unsigned int n)
+{
+    FFTSample t1, t2, t3, t4, t5, t6;
+    int o1 = 2*n;
+    int o2 = 4*n;
+    int o3 = 6*n;
+    const FFTSample *wim = wre+o1;
+
+    /* element 0 has the exact zero twiddle, 1-3 fill up the first vector */
+    TRANSFORM_ZERO(z[0],z[o1],z[o2],z[o3]);
+    for (int k = 1; k < 4; k++) {
+        TRANSFORM(z[k],z[o1+k],z[o2+k],z[o3+k],wre[k],wim[-k]);
+    }
+
+    for (int k = 4; k < o1; k += 4) {
+        v4sf a0r, a0i, a1r, a1i, a2r, a2i, a3r, a3i;
+        v_load_complex(z + k, a0r, a0i);
+        v_load_complex(z + o1 + k, a1r, a1i);
+        v_load_complex(z + o2 + k, a2r, a2i);
+        v_load_complex(z + o3 + k, a3r, a3i);
+        v4sf wr = v_load(wre + k);
+        v4sf wi = v_reverse(v_load(wim - k - 3));
+
+        v4sf vt1 = v_add(v_mul(a2r, wr), v_mul(a2i, wi));
+        v4sf vt2 = v_sub(v_mul(a2i, wr), v_mul(a2r, wi));
+        v4sf vt5 = v_sub(v_mul(a3r, wr), v_mul(a3i, wi));
+        v4sf vt6 = v_add(v_mul(a3i, wr), v_mul(a3r, wi));
+
+        v4sf vt3 = v_sub(vt5, vt1);
+        vt5 = v_add(vt5, vt1);
+        a2r = v_sub(a0r, vt5);
+        a0r = v_add(a0r, vt5);
+        a3i = v_sub(a1i, vt3);
+        a1i = v_add(a1i, vt3);
+        v4sf vt4 = v_sub(vt2, vt6);
+        vt6 = v_add(vt2, vt6);
+        a3r = v_sub(a1r, vt4);
+        a1r = v_add(a1r, vt4);
+        a2i = v_sub(a0i, vt6);
+        a0i = v_add(a0i, vt6);
+
+        v_store_complex(z + k, a0r, a0i);
+        v_store_complex(z + o1 + k, a1r, a1i);
+        v_store_complex(z + o2 + k, a2r, a2i);
+        v_store_complex(z + o3 + k, a3r, a3i);
+    }
+}
+
+#define DECL_FFT_SIMD(n,n2,n4)\
+static void fft##n##_simd(FFTComplex *z)\
+{\
+    fft##n2##_simd(z);\
+    fft##n4##_simd(z+n4*2);\
+    fft##n4##_simd(z+n4*3);\
+    pass_simd(z,ff_cos_##n,n4/2);\
+}
+
+/* the small sizes are fully unrolled already */
+#define fft4_simd fft4
+#define fft8_simd fft8
+#define fft16_simd fft16
+DECL_FFT_SIMD(32,16,8)
+DECL_FFT_SIMD(64,32,16)
+DECL_FFT_SIMD(128,64,32)
+DECL_FFT_SIMD(256,128,64)
+DECL_FFT_SIMD(512,256,128)
+DECL_FFT_SIMD(1024,512,256)
+DECL_FFT_SIMD(2048,1024,512)
+DECL_FFT_SIMD(4096,2048,1024)
+DECL_FFT_SIMD(8192,4096,2048)
+DECL_FFT_SIMD(16384,8192,4096)
+DECL_FFT_SIMD(32768,16384,8192)
+DECL_FFT_SIMD(65536,32768,16384)
+
+static void (* const fft_dispatch_simd[])(FFTComplex*) = {
+    fft4, fft8, fft16, fft32_simd, fft64_simd, fft128_simd, fft256_simd, fft512_simd, fft1024_simd,
+    fft2048_simd, fft4096_simd, fft8192_simd, fft16384_simd, fft32768_simd, fft65536_simd,
+};
+
+void ff_fft_calc_simd(const FFTContext *s, FFTComplex *z)
+{
+    fft_dispatch_simd[s->nbits-2](z);
+}
+#else
+void ff_fft_calc_simd(const FFTContext *s, FFTComplex *z)
+{
+    ff_fft_calc_c(s, z);
+}
+#endif
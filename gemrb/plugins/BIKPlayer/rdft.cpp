@@ -20,6 +20,7 @@
  */
 
 #include "dsputil.h"
+#include "simd.h"
 
 /**
  * @file libavcodec/rdft.c
@@ -61,6 +62,7 @@ av_cold int ff_rdft_init(RDFTContext *s, int nbits, enum RDFTransformType trans)
 
     if (ff_fft_init(&s->fft, nbits-1, trans == IRDFT || trans == RIDFT) < 0)
         return -1;
+    s->simd = ff_simd_supported();
 
     ff_init_ff_cos_tabs(nbits);
     s->tcos = ff_cos_tabs[nbits];
@@ -71,6 +73,48 @@ av_cold int ff_rdft_init(RDFTContext *s, int nbits, enum RDFTransformType trans)
     return 0;
 }
 
+#if HAVE_SIMD
+/**
+ * The unmangling loop of ff_rdft_calc_c() for four values of i at once,
+ * with the operations in the same order. The i2 side runs backwards, so
+ * those lanes are reversed on load and store.
+ * @return the first i left for the C loop
+ */
+static int rdft_unmangle_simd(FFTSample *data, int n, float k1, float k2,
+                              const FFTSample *tcos, const FFTSample *tsin)
+{
+    FFTComplex *z = (FFTComplex*)data;
+    const v4sf vk1 = v_set1(k1);
+    const v4sf vk2 = v_set1(k2);
+    const v4sf vnk2 = v_set1(-k2);
+    int i = 1;
+
+    for (; i + 3 < (n>>2); i += 4) {
+        v4sf ar, ai, br, bi;
+        v_load_complex(z + i, ar, ai);
+        v_load_complex(z + (n>>1) - i - 3, br, bi);
+        br = v_reverse(br);
+        bi = v_reverse(bi);
+        v4sf tc = v_load(tcos + i);
+        v4sf ts = v_load(tsin + i);
+
+        v4sf evre = v_mul(vk1, v_add(ar, br));
+        v4sf odim = v_mul(vnk2, v_sub(ar, br));
+        v4sf evim = v_mul(vk1, v_sub(ai, bi));
+        v4sf odre = v_mul(vk2, v_add(ai, bi));
+
+        ar = v_sub(v_add(evre, v_mul(odre, tc)), v_mul(odim, ts));
+        ai = v_add(v_add(evim, v_mul(odim, tc)), v_mul(odre, ts));
+        br = v_add(v_sub(evre, v_mul(odre, tc)), v_mul(odim, ts));
+        bi = v_add(v_add(v_neg(evim), v_mul(odim, tc)), v_mul(odre, ts));
+
+        v_store_complex(z + i, ar, ai);
+        v_store_complex(z + (n>>1) - i - 3, v_reverse(br), v_reverse(bi));
+    }
+    return i;
+}
+#endif
+
 /** Map one real FFT into two parallel real even and odd FFTs. Then interleave
  * the two real FFTs into one complex FFT. Unmangle the results.
  * ref: http://www.engineeringproductivitytools.com/stuff/T0001/PT10.HTM
@@ -94,7 +138,13 @@ static void ff_rdft_calc_c(RDFTContext* s, FFTSample* data)
     ev.re = data[0];
     data[0] = ev.re+data[1];
     data[1] = ev.re-data[1];
-    for (i = 1; i < (n>>2); i++) {
+    i = 1;
+#if HAVE_SIMD
+    if (s->simd) {
+        i = rdft_unmangle_simd(data, n, k1, k2, tcos, tsin);
+    }
+#endif
+    for (; i < (n>>2); i++) {
         i1 = 2*i;
         i2 = n-i1;
         /* Separate even and odd FFTs */
@@ -0,0 +1,98 @@
+/* GemRB - Infinity Engine Emulator
+ * Copyright (C) 2003 The GemRB Project
+ *
+ * This program is free software; you can redistribute it and/or
+ * modify it under the terms of the GNU General Public License
+ * as published by the Free Software Foundation; either version 2
+ * of the License, or (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE. See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 51 Franklin Street, Fifth Floor, Boston, MA 02110-1301, USA.
+ *
+ *
+ */
+
+/**
+ * @file simd.h
+ * Minimal 4 x float vector layer for the SSE2/NEON transform loops.
+ * Only plain IEEE add/sub/mul are exposed, so the vector code performs
+ * exactly the operations of the C code and stays bit-exact with it
+ * (the plugin is built without floating point contraction for this).
+ */
+
+#ifndef BIK_SIMD_H
+#define BIK_SIMD_H
+
+#include "dsputil.h"
+
+#if defined(__SSE2__) && (defined(__x86_64__) || defined(_M_X64))
+#define HAVE_SIMD 1
+#include <emmintrin.h>
+
+using v4sf = __m128;
+
+static inline v4sf v_load(const float* p) { return _mm_loadu_ps(p); }
+static inline v4sf v_add(v4sf a, v4sf b) { return _mm_add_ps(a, b); }
+static inline v4sf v_sub(v4sf a, v4sf b) { return _mm_sub_ps(a, b); }
+static inline v4sf v_mul(v4sf a, v4sf b) { return _mm_mul_ps(a, b); }
+static inline v4sf v_neg(v4sf a) { return _mm_xor_ps(a, _mm_set1_ps(-0.0f)); }
+static inline v4sf v_set1(float f) { return _mm_set1_ps(f); }
+static inline v4sf v_reverse(v4sf a) { return _mm_shuffle_ps(a, a, _MM_SHUFFLE(0, 1, 2, 3)); }
+
+/* z[0..3] into separate real and imaginary vectors */
+static inline void v_load_complex(const FFTComplex* z, v4sf& re, v4sf& im)
+{
+    v4sf lo = _mm_loadu_ps(&z[0].re);
+    v4sf hi = _mm_loadu_ps(&z[2].re);
+    re = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(2, 0, 2, 0));
+    im = _mm_shuffle_ps(lo, hi, _MM_SHUFFLE(3, 1, 3, 1));
+}
+
+static inline void v_store_complex(FFTComplex* z, v4sf re, v4sf im)
+{
+    _mm_storeu_ps(&z[0].re, _mm_unpacklo_ps(re, im));
+    _mm_storeu_ps(&z[2].re, _mm_unpackhi_ps(re, im));
+}
+
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define HAVE_SIMD 1
+#include <arm_neon.h>
+
+using v4sf = float32x4_t;
+
+static inline v4sf v_load(const float* p) { return vld1q_f32(p); }
+static inline v4sf v_add(v4sf a, v4sf b) { return vaddq_f32(a, b); }
+static inline v4sf v_sub(v4sf a, v4sf b) { return vsubq_f32(a, b); }
+static inline v4sf v_mul(v4sf a, v4sf b) { return vmulq_f32(a, b); }
+static inline v4sf v_neg(v4sf a) { return vnegq_f32(a); }
+static inline v4sf v_set1(float f) { return vdupq_n_f32(f); }
+static inline v4sf v_reverse(v4sf a)
+{
+    v4sf r = vrev64q_f32(a);
+    return vcombine_f32(vget_high_f32(r), vget_low_f32(r));
+}
+
+static inline void v_load_complex(const FFTComplex* z, v4sf& re, v4sf& im)
+{
+    float32x4x2_t v = vld2q_f32(&z[0].re);
+    re = v.val[0];
+    im = v.val[1];
+}
+
+static inline void v_store_complex(FFTComplex* z, v4sf re, v4sf im)
+{
+    float32x4x2_t v = {{ re, im }};
+    vst2q_f32(&z[0].re, v);
+}
+
+#else
+#define HAVE_SIMD 0
+#endif
+
+#endif /* BIK_SIMD_H */
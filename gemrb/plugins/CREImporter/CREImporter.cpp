@@ -757,10 +757,10 @@ CREKnownSpell* CREImporter::GetKnownSpell()
 	return spl;
 }
 
-void CREImporter::ReadScript(Actor *act, int ScriptLevel)
+void CREImporter::ReadScript(Actor *act, int ScriptLevel, BinaryView& header)
 {
 	ResRef aScript;
-	str->ReadResRef(aScript);
+	header.ReadResRef(aScript);
 	act->SetScript(aScript, ScriptLevel, act->InParty != 0);
 }
 
@@ -824,10 +824,10 @@ void CREImporter::SetupColor(ieDword &stat) const
 	stat = colors->second[RAND<ieDword>(ieDword(0), RandRows - 1)];
 }
 
-void CREImporter::ReadDialog(Actor *act)
+void CREImporter::ReadDialog(Actor *act, BinaryView& header)
 {
 	ResRef Dialog;
-	str->ReadResRef(Dialog);
+	header.ReadResRef(Dialog);
 	// avoiding a literal NONE to not error, since the file doesn't exist
 	if (Dialog == "NONE") {
 		Dialog.Reset();
@@ -835,15 +835,33 @@ void CREImporter::ReadDialog(Actor *act)
 	act->SetDialog(Dialog);
 }
 
+// size of the whole fixed header, including the signature
+static strpos_t HeaderSize(unsigned char version)
+{
+	switch (version) {
+		case IE_CRE_V1_2:
+			return 0x378;
+		case IE_CRE_V2_2:
+			return 0x62e;
+		case IE_CRE_V9_0:
+			return 0x33c;
+		default:
+			return 0x2d4;
+	}
+}
+
 Actor* CREImporter::GetActor(unsigned char is_in_party)
 {
+	// parse the fixed header from a single view instead of the stream
+	BinaryView header(str, HeaderSize(CREVersion) - 8);
+
 	Actor* act = new Actor();
 	act->InParty = is_in_party;
-	str->ReadStrRef(act->LongStrRef);
+	header.ReadStrRef(act->LongStrRef);
 	//Beetle name in IWD needs the allow zero flag
 	String poi = core->GetString( act->LongStrRef, STRING_FLAGS::ALLOW_ZERO );
 	act->SetName(std::move(poi), 1); //setting longname
-	str->ReadStrRef(act->ShortStrRef);
+	header.ReadStrRef(act->ShortStrRef);
 	if (act->ShortStrRef == (ieStrRef) -1) {
 		act->ShortStrRef = act->LongStrRef;
 	}
@@ -851,23 +869,23 @@ Actor* CREImporter::GetActor(unsigned char is_in_party)
 	act->SetName(std::move(poi), 2); //setting shortname (for tooltips)
 	act->BaseStats[IE_VISUALRANGE] = VOODOO_VISUAL_RANGE; // not stored anywhere
 	act->BaseStats[IE_DIALOGRANGE] = VOODOO_DIALOG_RANGE;
-	str->ReadDword(act->BaseStats[IE_MC_FLAGS]);
-	str->ReadDword(act->BaseStats[IE_XPVALUE]);
-	str->ReadDword(act->BaseStats[IE_XP]);
-	str->ReadDword(act->BaseStats[IE_GOLD]);
-	str->ReadDword(act->BaseStats[IE_STATE_ID]);
+	header.ReadDword(act->BaseStats[IE_MC_FLAGS]);
+	header.ReadDword(act->BaseStats[IE_XPVALUE]);
+	header.ReadDword(act->BaseStats[IE_XP]);
+	header.ReadDword(act->BaseStats[IE_GOLD]);
+	header.ReadDword(act->BaseStats[IE_STATE_ID]);
 	ieWord tmp;
 	ieWordSigned tmps;
-	str->ReadScalar(tmps);
+	header.ReadScalar(tmps);
 	act->BaseStats[IE_HITPOINTS]=(ieDwordSigned)tmps;
 	if (tmps <= 0 && ((ieDwordSigned) act->BaseStats[IE_XPVALUE]) < 0) {
 		act->BaseStats[IE_STATE_ID] |= STATE_DEAD;
 	}
-	str->ReadWord(tmp);
+	header.ReadWord(tmp);
 	act->BaseStats[IE_MAXHITPOINTS]=tmp;
-	str->ReadDword(act->BaseStats[IE_ANIMATION_ID]);//animID is a dword
+	header.ReadDword(act->BaseStats[IE_ANIMATION_ID]);//animID is a dword
 	ieByte tmp2[7];
-	str->Read( tmp2, 7);
+	header.Read( tmp2, 7);
 	for (int i=0;i<7;i++) {
 		ieDword t = tmp2[i];
 		// apply RANDCOLR.2DA transformation
@@ -877,7 +895,7 @@ Actor* CREImporter::GetActor(unsigned char is_in_party)
 		act->BaseStats[IE_COLORS+i]=t;
 	}
 
-	str->Read( &TotSCEFF, 1 );
+	header.Read( &TotSCEFF, 1 );
 	if (CREVersion==IE_CRE_V1_0 && TotSCEFF) {
 		CREVersion = IE_CRE_V1_1;
 	}
@@ -886,11 +904,11 @@ Actor* CREImporter::GetActor(unsigned char is_in_party)
 	if (core->config.SaveAsOriginal) {
 		act->version = CREVersion;
 	}
-	str->ReadResRef( act->SmallPortrait );
+	header.ReadResRef( act->SmallPortrait );
 	if (act->SmallPortrait.IsEmpty()) {
 		act->SmallPortrait = "NONE";
 	}
-	str->ReadResRef( act->LargePortrait );
+	header.ReadResRef( act->LargePortrait );
 	if (act->LargePortrait.IsEmpty()) {
 		act->LargePortrait = "NONE";
 	}
@@ -899,24 +917,24 @@ Actor* CREImporter::GetActor(unsigned char is_in_party)
 
 	switch(CREVersion) {
 		case IE_CRE_GEMRB:
-			Inventory_Size = GetActorGemRB(act);
+			Inventory_Size = GetActorGemRB(act, header);
 			break;
 		case IE_CRE_V1_2:
 			Inventory_Size=46;
-			GetActorPST(act);
+			GetActorPST(act, header);
 			break;
 		case IE_CRE_V1_1: //bg2 (fake version)
 		case IE_CRE_V1_0: //bg1 too
 			Inventory_Size=38;
-			GetActorBG(act);
+			GetActorBG(act, header);
 			break;
 		case IE_CRE_V2_2:
 			Inventory_Size=50;
-			GetActorIWD2(act);
+			GetActorIWD2(act, header);
 			break;
 		case IE_CRE_V9_0:
 			Inventory_Size=38;
-			GetActorIWD1(act);
+			GetActorIWD1(act, header);
 			break;
 		default:
 			Log(ERROR, "CREImporter", "Unknown creature signature: {}\n", CREVersion);
@@ -943,212 +961,212 @@ Actor* CREImporter::GetActor(unsigned char is_in_party)
 	return act;
 }
 
-void CREImporter::GetActorPST(Actor *act)
+void CREImporter::GetActorPST(Actor *act, BinaryView& header)
 {
 	ieByte tmpByte;
 	ieWord tmpWord;
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_REPUTATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	//skipping a word
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->AC.SetNatural((ieWordSigned) tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACCRUSHINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACMISSILEMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACPIERCINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACSLASHINGMOD]=(ieWordSigned) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->ToHit.SetBase((ieByteSigned) tmpByte);
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	tmpByte = tmpByte * 2;
 	if (tmpByte>10) tmpByte-=11;
 	act->BaseStats[IE_NUMBEROFATTACKS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSDEATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSWANDS]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSPOLY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSBREATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSSPELL]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTELECTRICITY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTACID]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGIC]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTSLASHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCRUSHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTPIERCING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMISSILE]=(ieByteSigned) tmpByte;
 	//this is used for unused prof points count
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FREESLOTS]=tmpByte; //using another field than usually
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SETTRAPS]=tmpByte; //this is unused in pst
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LORE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LOCKPICKING]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STEALTH]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_PICKPOCKET]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FATIGUE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INTOXICATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LUCK]=(ieByteSigned) tmpByte;
 	//last byte is actually an undead level (according to IE dev info)
 	for (int i = 0; i < 21; i++) {
-		str->Read( &tmpByte, 1 );
+		header.Read( &tmpByte, 1 );
 		act->BaseStats[IE_PROFICIENCYBASTARDSWORD+i]=tmpByte;
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRACKING]=tmpByte;
 	//scriptname of tracked creature (according to IE dev info)
-	str->Seek( 32, GEM_CURRENT_POS );
+	header.Seek( 32, GEM_CURRENT_POS );
 	for (auto& ref : act->StrRefs) {
-		str->ReadStrRef(ref);
+		header.ReadStrRef(ref);
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL2]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL3]=tmpByte;
 	//this is rumoured to be IE_SEX, but we use the gender field for this
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//skipping a byte
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STREXTRA]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INT]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_WIS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DEX]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CON]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CHR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALEBREAK]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HATEDRACE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALERECOVERYTIME]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//skipping a byte
-	str->ReadDword(act->BaseStats[IE_KIT]);
-	ReadScript(act, SCR_OVERRIDE);
-	ReadScript(act, SCR_CLASS);
-	ReadScript(act, SCR_RACE);
-	ReadScript(act, SCR_GENERAL);
-	ReadScript(act, SCR_DEFAULT);
-
-	str->Seek( 36, GEM_CURRENT_POS );
+	header.ReadDword(act->BaseStats[IE_KIT]);
+	ReadScript(act, SCR_OVERRIDE, header);
+	ReadScript(act, SCR_CLASS, header);
+	ReadScript(act, SCR_RACE, header);
+	ReadScript(act, SCR_GENERAL, header);
+	ReadScript(act, SCR_DEFAULT, header);
+
+	header.Seek( 36, GEM_CURRENT_POS );
 	//the overlays are not fully decoded yet
 	//they are a kind of effect block (like our vvclist)
-	str->ReadDword(OverlayOffset);
-	str->ReadDword(OverlayMemorySize);
-	str->ReadDword(act->BaseStats[IE_XP_MAGE]); // Exp for secondary class
-	str->ReadDword(act->BaseStats[IE_XP_THIEF]); // Exp for tertiary class
+	header.ReadDword(OverlayOffset);
+	header.ReadDword(OverlayMemorySize);
+	header.ReadDword(act->BaseStats[IE_XP_MAGE]); // Exp for secondary class
+	header.ReadDword(act->BaseStats[IE_XP_THIEF]); // Exp for tertiary class
 	for (int i = 0; i < 10; i++) {
-		str->ReadWord(tmpWord);
+		header.ReadWord(tmpWord);
 		act->BaseStats[IE_INTERNAL_0+i]=tmpWord;
 	}
 	//good, law, lady, murder
 	for (auto& counter : act->DeathCounters) {
-		str->Read( &tmpByte, 1);
+		header.Read( &tmpByte, 1);
 		counter = (ieByteSigned) tmpByte;
 	}
 	ieVariable KillVar; //use this as needed
-	str->ReadVariable(KillVar);
-	str->Seek( 3, GEM_CURRENT_POS ); // dialog radius, feet circle size???
+	header.ReadVariable(KillVar);
+	header.Seek( 3, GEM_CURRENT_POS ); // dialog radius, feet circle size???
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 
-	str->ReadDword(act->AppearanceFlags);
+	header.ReadDword(act->AppearanceFlags);
 
 	// just overwrite the bg1 color stat range, since it's not used in pst
 	for (int i = 0; i < 7; i++) {
-		str->ReadWord(tmpWord);
+		header.ReadWord(tmpWord);
 		act->BaseStats[IE_COLORS+i] = tmpWord;
 	}
 	act->BaseStats[IE_COLORCOUNT] = tmpByte;
-	str->Read(act->pstColorBytes, 10); // color location in IESDP, sort of a palette index and flags
-	str->Seek(21, GEM_CURRENT_POS);
-	str->Read( &tmpByte, 1 );
+	header.Read(act->pstColorBytes, 10); // color location in IESDP, sort of a palette index and flags
+	header.Seek(21, GEM_CURRENT_POS);
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SPECIES]=tmpByte; // offset: 0x311
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TEAM]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FACTION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_EA]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_GENERAL]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RACE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CLASS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SPECIFIC]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SEX]=tmpByte;
-	str->Seek( 5, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1 );
+	header.Seek( 5, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_ALIGNMENT]=tmpByte;
-	str->Seek( 4, GEM_CURRENT_POS );
+	header.Seek( 4, GEM_CURRENT_POS );
 	ieVariable scriptname;
-	str->ReadVariable(scriptname);
+	header.ReadVariable(scriptname);
 	act->SetScriptName(scriptname);
 	act->KillVar = MakeVariable(KillVar);
 	act->IncKillVar.Reset();
 
-	str->ReadDword(KnownSpellsOffset);
-	str->ReadDword(KnownSpellsCount);
-	str->ReadDword(SpellMemorizationOffset);
-	str->ReadDword(SpellMemorizationCount);
-	str->ReadDword(MemorizedSpellsOffset);
-	str->ReadDword(MemorizedSpellsCount);
+	header.ReadDword(KnownSpellsOffset);
+	header.ReadDword(KnownSpellsCount);
+	header.ReadDword(SpellMemorizationOffset);
+	header.ReadDword(SpellMemorizationCount);
+	header.ReadDword(MemorizedSpellsOffset);
+	header.ReadDword(MemorizedSpellsCount);
 
-	str->ReadDword(ItemSlotsOffset);
-	str->ReadDword(ItemsOffset);
-	str->ReadDword(ItemsCount);
-	str->ReadDword(EffectsOffset);
-	str->ReadDword(EffectsCount); //also variables
+	header.ReadDword(ItemSlotsOffset);
+	header.ReadDword(ItemsOffset);
+	header.ReadDword(ItemsCount);
+	header.ReadDword(EffectsOffset);
+	header.ReadDword(EffectsCount); //also variables
 
-	ReadDialog(act);
+	ReadDialog(act, header);
 }
 
 void CREImporter::ReadInventory(Actor *act, unsigned int Inventory_Size)
@@ -1293,261 +1311,261 @@ Effect *CREImporter::GetEffect()
 	}
 }
 
-ieDword CREImporter::GetActorGemRB(Actor *act)
+ieDword CREImporter::GetActorGemRB(Actor *act, BinaryView& header)
 {
 	ieByte tmpByte;
 	ieWord tmpWord;
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_REPUTATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
 	//skipping a word( useful for something)
-	str->ReadWord(tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->AC.SetNatural((ieWordSigned) tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACCRUSHINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACMISSILEMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACPIERCINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACSLASHINGMOD]=(ieWordSigned) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->ToHit.SetBase((ieByteSigned) tmpByte);
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_NUMBEROFATTACKS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSDEATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSWANDS]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSPOLY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSBREATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSSPELL]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTELECTRICITY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTACID]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGIC]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTSLASHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCRUSHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTPIERCING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMISSILE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DETECTILLUSIONS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SETTRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LORE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LOCKPICKING]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STEALTH]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_PICKPOCKET]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FATIGUE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INTOXICATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LUCK]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//these could be used to save iwd2 skills
 	//TODO: gemrb format
 	act->BaseStats[IE_TRACKING]=tmpByte;
 	for (ieStrRef& StrRef : act->StrRefs) {
-		str->ReadStrRef(StrRef);
+		header.ReadStrRef(StrRef);
 	}
 	return 0;
 }
 
-void CREImporter::GetActorBG(Actor *act)
+void CREImporter::GetActorBG(Actor *act, BinaryView& header)
 {
 	ieByte tmpByte;
 	ieWord tmpWord;
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_REPUTATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	//skipping a word, labeled ArmorClass vs ArmorClassBase, so probably just the last computed value and thus useless
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->AC.SetNatural((ieWordSigned) tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACCRUSHINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACMISSILEMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACPIERCINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACSLASHINGMOD]=(ieWordSigned) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->ToHit.SetBase((ieByteSigned) tmpByte);
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	tmpWord = tmpByte * 2;
 	if (tmpWord>10) tmpWord-=11;
 	act->BaseStats[IE_NUMBEROFATTACKS]=(ieByte) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSDEATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSWANDS]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSPOLY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSBREATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSSPELL]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTELECTRICITY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTACID]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGIC]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTSLASHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCRUSHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTPIERCING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMISSILE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DETECTILLUSIONS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SETTRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LORE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LOCKPICKING]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STEALTH]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_PICKPOCKET]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FATIGUE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INTOXICATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LUCK]=(ieByteSigned) tmpByte;
 	for (int i = 0; i < 21; i++) {
-		str->Read( &tmpByte, 1 );
+		header.Read( &tmpByte, 1 );
 		act->BaseStats[IE_PROFICIENCYBASTARDSWORD+i]=tmpByte;
 	}
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRACKING]=tmpByte;
-	str->Seek( 32, GEM_CURRENT_POS );
+	header.Seek( 32, GEM_CURRENT_POS );
 	for (auto& ref : act->StrRefs) {
-		str->ReadStrRef(ref);
+		header.ReadStrRef(ref);
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL2]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL3]=tmpByte;
 	//this is IE_SEX, but we use the gender field for this
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	//skipping a byte
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_STR]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_STREXTRA]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_INT]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_WIS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_DEX]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CON]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CHR]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_MORALE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_MORALEBREAK]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_HATEDRACE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_MORALERECOVERYTIME]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	//skipping a byte, labeled MageSpecUpperWorld, while kit was MageSpecialization
-	str->ReadDword(act->BaseStats[IE_KIT]);
+	header.ReadDword(act->BaseStats[IE_KIT]);
 	act->BaseStats[IE_KIT] = ((act->BaseStats[IE_KIT] & 0xffff) << 16) +
 		((act->BaseStats[IE_KIT] & 0xffff0000) >> 16);
-	ReadScript(act, SCR_OVERRIDE);
-	ReadScript(act, SCR_CLASS);
-	ReadScript(act, SCR_RACE);
-	ReadScript(act, SCR_GENERAL);
-	ReadScript(act, SCR_DEFAULT);
+	ReadScript(act, SCR_OVERRIDE, header);
+	ReadScript(act, SCR_CLASS, header);
+	ReadScript(act, SCR_RACE, header);
+	ReadScript(act, SCR_GENERAL, header);
+	ReadScript(act, SCR_DEFAULT, header);
 
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_EA]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_GENERAL]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_RACE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CLASS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SPECIFIC]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SEX]=tmpByte;
-	str->Seek(5, GEM_CURRENT_POS); // 5x SpecialCase in bg2/ee
-	str->Read( &tmpByte, 1);
+	header.Seek(5, GEM_CURRENT_POS); // 5x SpecialCase in bg2/ee
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_ALIGNMENT]=tmpByte;
-	str->Seek(4, GEM_CURRENT_POS); // dword labeled Instance
+	header.Seek(4, GEM_CURRENT_POS); // dword labeled Instance
 	ieVariable scriptname;
-	str->ReadVariable(scriptname);
+	header.ReadVariable(scriptname);
 	act->SetScriptName(scriptname);
 	act->KillVar.Reset();
 	act->IncKillVar.Reset();
 
-	str->ReadDword(KnownSpellsOffset);
-	str->ReadDword(KnownSpellsCount);
-	str->ReadDword(SpellMemorizationOffset);
-	str->ReadDword(SpellMemorizationCount);
-	str->ReadDword(MemorizedSpellsOffset);
-	str->ReadDword(MemorizedSpellsCount);
+	header.ReadDword(KnownSpellsOffset);
+	header.ReadDword(KnownSpellsCount);
+	header.ReadDword(SpellMemorizationOffset);
+	header.ReadDword(SpellMemorizationCount);
+	header.ReadDword(MemorizedSpellsOffset);
+	header.ReadDword(MemorizedSpellsCount);
 
-	str->ReadDword(ItemSlotsOffset);
-	str->ReadDword(ItemsOffset);
-	str->ReadDword(ItemsCount);
-	str->ReadDword(EffectsOffset);
-	str->ReadDword(EffectsCount);
+	header.ReadDword(ItemSlotsOffset);
+	header.ReadDword(ItemsOffset);
+	header.ReadDword(ItemsCount);
+	header.ReadDword(EffectsOffset);
+	header.ReadDword(EffectsCount);
 
-	ReadDialog(act);
+	ReadDialog(act, header);
 }
 
 void CREImporter::GetIWD2Spellpage(Actor *act, ieIWD2SpellType type, int level, int count)
@@ -1611,237 +1629,237 @@ void CREImporter::GetIWD2Spellpage(Actor *act, ieIWD2SpellType type, int level,
 	}
 }
 
-void CREImporter::GetActorIWD2(Actor *act)
+void CREImporter::GetActorIWD2(Actor *act, BinaryView& header)
 {
 	ieByte tmpByte;
 	ieWord tmpWord;
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_REPUTATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->AC.SetNatural((ieWordSigned) tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACCRUSHINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACMISSILEMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACPIERCINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACSLASHINGMOD]=(ieWordSigned) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->ToHit.SetBase((ieByteSigned) tmpByte);//Unknown in CRE V2.2
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_NUMBEROFATTACKS]=tmpByte;//Unknown in CRE V2.2
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSDEATH]=(ieByteSigned) tmpByte;//Fortitude Save in V2.2
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSWANDS]=(ieByteSigned) tmpByte;//Reflex Save in V2.2
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSPOLY]=(ieByteSigned) tmpByte;// will Save in V2.2
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTELECTRICITY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTACID]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGIC]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTSLASHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCRUSHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTPIERCING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMISSILE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MAGICDAMAGERESISTANCE]=(ieByteSigned) tmpByte;
-	str->Seek( 4, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1 );
+	header.Seek( 4, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FATIGUE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INTOXICATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LUCK]=(ieByteSigned) tmpByte;
-	str->Seek( 34, GEM_CURRENT_POS ); //unknowns
-	str->Read( &tmpByte, 1 );
+	header.Seek( 34, GEM_CURRENT_POS ); //unknowns
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CLASSLEVELSUM]=tmpByte; //total levels
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELBARBARIAN]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELBARD]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELCLERIC]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELDRUID]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELFIGHTER]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELMONK]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELPALADIN]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELRANGER]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELTHIEF]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELSORCERER]=tmpByte;
-	str->Read( & tmpByte, 1 );
+	header.Read( & tmpByte, 1 );
 	act->BaseStats[IE_LEVELMAGE]=tmpByte;
-	str->Seek( 22, GEM_CURRENT_POS ); //levels for classes
+	header.Seek( 22, GEM_CURRENT_POS ); //levels for classes
 	for (int i = 0; i < 64; i++) {
-		str->ReadStrRef(act->StrRefs[i]);
-	}
-	ReadScript( act, SCR_SPECIFICS);
-	ReadScript( act, SCR_AREA);
-	str->Seek( 4, GEM_CURRENT_POS );
-	str->ReadDword(act->BaseStats[IE_FEATS1]);
-	str->ReadDword(act->BaseStats[IE_FEATS2]);
-	str->ReadDword(act->BaseStats[IE_FEATS3]);
-	str->Seek( 12, GEM_CURRENT_POS );
+		header.ReadStrRef(act->StrRefs[i]);
+	}
+	ReadScript(act, SCR_SPECIFICS, header);
+	ReadScript(act, SCR_AREA, header);
+	header.Seek( 4, GEM_CURRENT_POS );
+	header.ReadDword(act->BaseStats[IE_FEATS1]);
+	header.ReadDword(act->BaseStats[IE_FEATS2]);
+	header.ReadDword(act->BaseStats[IE_FEATS3]);
+	header.Seek( 12, GEM_CURRENT_POS );
 	//proficiencies
 	for (int i = 0; i < 26; i++) {
-		str->Read( &tmpByte, 1);
+		header.Read( &tmpByte, 1);
 		act->BaseStats[IE_PROFICIENCYBASTARDSWORD+i]=tmpByte;
 	}
 	//skills
-	str->Seek( 38, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 38, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_ALCHEMY]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_ANIMALS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_BLUFF]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CONCENTRATION]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_DIPLOMACY]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_TRAPS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_INTIMIDATE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_LORE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_STEALTH]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_LOCKPICKING]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_PICKPOCKET]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SEARCH]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SPELLCRAFT]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_MAGICDEVICE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_TRACKING]=tmpByte;
-	str->Seek( 50, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 50, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HATEDRACE]=tmpByte;
 	//we got 7 more hated races
 	for (int i = 0; i < 7; i++) {
-		str->Read( &tmpByte, 1 );
+		header.Read( &tmpByte, 1 );
 		act->BaseStats[IE_HATEDRACE2+i]=tmpByte;
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SUBRACE]=tmpByte;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	//skipping 2 bytes, one is SEX (could use it for sounds)
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INT]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_WIS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DEX]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CON]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CHR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALEBREAK]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//HatedRace is a list of races, so this is skipped here
 	//act->BaseStats[IE_HATEDRACE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALERECOVERYTIME]=tmpByte;
 	//No KIT word order magic for IWD2
-	str->ReadDword(act->BaseStats[IE_KIT]);
-	ReadScript(act, SCR_OVERRIDE);
-	ReadScript(act, SCR_CLASS);
-	ReadScript(act, SCR_RACE);
-	ReadScript(act, SCR_GENERAL);
-	ReadScript(act, SCR_DEFAULT);
+	header.ReadDword(act->BaseStats[IE_KIT]);
+	ReadScript(act, SCR_OVERRIDE, header);
+	ReadScript(act, SCR_CLASS, header);
+	ReadScript(act, SCR_RACE, header);
+	ReadScript(act, SCR_GENERAL, header);
+	ReadScript(act, SCR_DEFAULT, header);
 	//new scripting flags, one on each byte
-	str->Read( &tmpByte, 1); //hidden
+	header.Read( &tmpByte, 1); //hidden
 	if (tmpByte) {
 		act->BaseStats[IE_AVATARREMOVAL]=tmpByte;
 	}
-	str->Read( &act->SetDeathVar, 1); //set death variable
-	str->Read( &act->IncKillCount, 1); //increase kill count
-	str->Read( &act->UnknownField, 1);
+	header.Read( &act->SetDeathVar, 1); //set death variable
+	header.Read( &act->IncKillCount, 1); //increase kill count
+	header.Read( &act->UnknownField, 1);
 	for (int i = 0; i < 5; i++) {
-		str->ReadWord(tmpWord);
+		header.ReadWord(tmpWord);
 		act->BaseStats[IE_INTERNAL_0+i]=tmpWord;
 	}
 	ieVariable KillVar;
-	str->ReadVariable(KillVar);
+	header.ReadVariable(KillVar);
 	act->KillVar = MakeVariable(KillVar);
-	str->ReadVariable(KillVar);
+	header.ReadVariable(KillVar);
 	act->IncKillVar = MakeVariable(KillVar);
-	str->Seek( 2, GEM_CURRENT_POS);
-	str->ReadWord(tmpWord);
+	header.Seek( 2, GEM_CURRENT_POS);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDXPOS] = tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDYPOS] = tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDFACE] = tmpWord;
 
-	str->Seek( 15, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 15, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_TRANSLUCENT]=tmpByte;
-	str->Read( &tmpByte, 1); //fade speed
-	str->Read( &tmpByte, 1); //spec. flags
+	header.Read( &tmpByte, 1); //fade speed
+	header.Read( &tmpByte, 1); //spec. flags
 	act->BaseStats[IE_SPECFLAGS] = tmpByte;
-	str->Read( &tmpByte, 1); //invisible
-	str->ReadWord(tmpWord); //unknown
-	str->Read( &tmpByte, 1); //unused skill points
+	header.Read( &tmpByte, 1); //invisible
+	header.ReadWord(tmpWord); //unknown
+	header.Read( &tmpByte, 1); //unused skill points
 	act->BaseStats[IE_UNUSED_SKILLPTS] = tmpByte;
-	str->Seek( 124, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 124, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_EA]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_GENERAL]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_RACE]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CLASS]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SPECIFIC]=tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SEX]=tmpByte;
-	str->Seek( 5, GEM_CURRENT_POS ); // object.ids references that we don't save
-	str->Read( &tmpByte, 1);
+	header.Seek( 5, GEM_CURRENT_POS ); // object.ids references that we don't save
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_ALIGNMENT]=tmpByte;
-	str->Seek( 4, GEM_CURRENT_POS );
+	header.Seek( 4, GEM_CURRENT_POS );
 	ieVariable scriptname;
-	str->ReadVariable(scriptname);
+	header.ReadVariable(scriptname);
 	act->SetScriptName(scriptname);
 
 	KnownSpellsOffset = 0;
@@ -1851,43 +1869,43 @@ void CREImporter::GetActorIWD2(Actor *act)
 	MemorizedSpellsOffset = 0;
 	MemorizedSpellsCount = 0;
 	// skipping class (probably redundant), class mask (calculated)
-	str->Seek(6, GEM_CURRENT_POS);
+	header.Seek(6, GEM_CURRENT_POS);
 	ieDword ClassSpellOffsets[8*9];
 
 	//spellbook spells
 	for (int i = 0; i < 7 * 9; i++) {
-		str->ReadDword(ClassSpellOffsets[i]);
+		header.ReadDword(ClassSpellOffsets[i]);
 	}
 	ieDword ClassSpellCounts[8*9];
 	for (int i = 0; i < 7 * 9; i++) {
-		str->ReadDword(ClassSpellCounts[i]);
+		header.ReadDword(ClassSpellCounts[i]);
 	}
 
 	//domain spells
 	for (int i = 7*9; i < 8 * 9; i++) {
-		str->ReadDword(ClassSpellOffsets[i]);
+		header.ReadDword(ClassSpellOffsets[i]);
 	}
 	for (int i = 7*9; i < 8 * 9; i++) {
-		str->ReadDword(ClassSpellCounts[i]);
+		header.ReadDword(ClassSpellCounts[i]);
 	}
 
 	ieDword InnateOffset, InnateCount;
 	ieDword SongOffset, SongCount;
 	ieDword ShapeOffset, ShapeCount;
-	str->ReadDword(InnateOffset);
-	str->ReadDword(InnateCount);
-	str->ReadDword(SongOffset);
-	str->ReadDword(SongCount);
-	str->ReadDword(ShapeOffset);
-	str->ReadDword(ShapeCount);
+	header.ReadDword(InnateOffset);
+	header.ReadDword(InnateCount);
+	header.ReadDword(SongOffset);
+	header.ReadDword(SongCount);
+	header.ReadDword(ShapeOffset);
+	header.ReadDword(ShapeCount);
 
-	str->ReadDword(ItemSlotsOffset);
-	str->ReadDword(ItemsOffset);
-	str->ReadDword(ItemsCount);
-	str->ReadDword(EffectsOffset);
-	str->ReadDword(EffectsCount);
+	header.ReadDword(ItemSlotsOffset);
+	header.ReadDword(ItemsOffset);
+	header.ReadDword(ItemsCount);
+	header.ReadDword(EffectsOffset);
+	header.ReadDword(EffectsCount);
 
-	ReadDialog(act);
+	ReadDialog(act, header);
 
 	for (int i = 0; i < 8; i++) {
 		for(int lev=0;lev<9;lev++) {
@@ -1906,195 +1924,195 @@ void CREImporter::GetActorIWD2(Actor *act)
 	GetIWD2Spellpage(act, IE_IWD2_SPELL_SHAPE, 0, ShapeCount);
 }
 
-void CREImporter::GetActorIWD1(Actor *act) //9.0
+void CREImporter::GetActorIWD1(Actor *act, BinaryView& header) //9.0
 {
 	ieByte tmpByte;
 	ieWord tmpWord;
 
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_REPUTATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HIDEINSHADOWS]=tmpByte;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	//skipping a word
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->AC.SetNatural((ieWordSigned) tmpWord);
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACCRUSHINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACMISSILEMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACPIERCINGMOD]=(ieWordSigned) tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_ACSLASHINGMOD]=(ieWordSigned) tmpWord;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->ToHit.SetBase((ieByteSigned) tmpByte);
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	tmpByte = tmpByte * 2;
 	if (tmpByte>10) tmpByte-=11;
 	act->BaseStats[IE_NUMBEROFATTACKS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSDEATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSWANDS]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSPOLY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSBREATH]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SAVEVSSPELL]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTELECTRICITY]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTACID]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGIC]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICFIRE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMAGICCOLD]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTSLASHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTCRUSHING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTPIERCING]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_RESISTMISSILE]=(ieByteSigned) tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DETECTILLUSIONS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_SETTRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LORE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LOCKPICKING]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STEALTH]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRAPS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_PICKPOCKET]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_FATIGUE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INTOXICATION]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LUCK]=(ieByteSigned) tmpByte;
 	for (int i = 0; i < 21; i++) {
-		str->Read( &tmpByte, 1 );
+		header.Read( &tmpByte, 1 );
 		act->BaseStats[IE_PROFICIENCYBASTARDSWORD+i]=tmpByte;
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_TRACKING]=tmpByte;
-	str->Seek( 32, GEM_CURRENT_POS );
+	header.Seek( 32, GEM_CURRENT_POS );
 	for (auto& ref : act->StrRefs) {
-		str->ReadStrRef(ref);
+		header.ReadStrRef(ref);
 	}
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL2]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_LEVEL3]=tmpByte;
 	//this is rumoured to be IE_SEX, but we use the gender field for this
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//skipping a byte
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_STREXTRA]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_INT]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_WIS]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_DEX]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CON]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_CHR]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALEBREAK]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_HATEDRACE]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	act->BaseStats[IE_MORALERECOVERYTIME]=tmpByte;
-	str->Read( &tmpByte, 1 );
+	header.Read( &tmpByte, 1 );
 	//skipping a byte
-	str->ReadDword(act->BaseStats[IE_KIT]);
+	header.ReadDword(act->BaseStats[IE_KIT]);
 	act->BaseStats[IE_KIT] = ((act->BaseStats[IE_KIT] & 0xffff) << 16) +
 		((act->BaseStats[IE_KIT] & 0xffff0000) >> 16);
-	ReadScript(act, SCR_OVERRIDE);
-	ReadScript(act, SCR_CLASS);
-	ReadScript(act, SCR_RACE);
-	ReadScript(act, SCR_GENERAL);
-	ReadScript(act, SCR_DEFAULT);
+	ReadScript(act, SCR_OVERRIDE, header);
+	ReadScript(act, SCR_CLASS, header);
+	ReadScript(act, SCR_RACE, header);
+	ReadScript(act, SCR_GENERAL, header);
+	ReadScript(act, SCR_DEFAULT, header);
 	//new scripting flags, one on each byte
-	str->Read( &tmpByte, 1); //hidden
+	header.Read( &tmpByte, 1); //hidden
 	if (tmpByte) {
 		act->BaseStats[IE_AVATARREMOVAL]=tmpByte;
 	}
-	str->Read( &act->SetDeathVar, 1); //set death variable
-	str->Read( &act->IncKillCount, 1); //increase kill count
-	str->Read( &act->UnknownField, 1);
+	header.Read( &act->SetDeathVar, 1); //set death variable
+	header.Read( &act->IncKillCount, 1); //increase kill count
+	header.Read( &act->UnknownField, 1);
 	for (int i = 0; i < 5; i++) {
-		str->ReadWord(tmpWord);
+		header.ReadWord(tmpWord);
 		act->BaseStats[IE_INTERNAL_0+i]=tmpWord;
 	}
 	ieVariable KillVar;
-	str->ReadVariable(KillVar); // use these as needed
+	header.ReadVariable(KillVar); // use these as needed
 	act->KillVar = MakeVariable(KillVar);
-	str->ReadVariable(KillVar);
+	header.ReadVariable(KillVar);
 	act->IncKillVar = MakeVariable(KillVar);
-	str->Seek( 2, GEM_CURRENT_POS);
-	str->ReadWord(tmpWord);
+	header.Seek( 2, GEM_CURRENT_POS);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDXPOS] = tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDYPOS] = tmpWord;
-	str->ReadWord(tmpWord);
+	header.ReadWord(tmpWord);
 	act->BaseStats[IE_SAVEDFACE] = tmpWord;
-	str->Seek( 18, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 18, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_EA] = tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_GENERAL] = tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_RACE] = tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_CLASS] = tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SPECIFIC] = tmpByte;
-	str->Read( &tmpByte, 1);
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_SEX] = tmpByte;
-	str->Seek( 5, GEM_CURRENT_POS );
-	str->Read( &tmpByte, 1);
+	header.Seek( 5, GEM_CURRENT_POS );
+	header.Read( &tmpByte, 1);
 	act->BaseStats[IE_ALIGNMENT]=tmpByte;
-	str->Seek( 4, GEM_CURRENT_POS );
+	header.Seek( 4, GEM_CURRENT_POS );
 	ieVariable scriptname;
-	str->ReadVariable(scriptname);
+	header.ReadVariable(scriptname);
 	act->SetScriptName(scriptname);
 
-	str->ReadDword(KnownSpellsOffset);
-	str->ReadDword(KnownSpellsCount);
-	str->ReadDword(SpellMemorizationOffset);
-	str->ReadDword(SpellMemorizationCount);
-	str->ReadDword(MemorizedSpellsOffset);
-	str->ReadDword(MemorizedSpellsCount);
+	header.ReadDword(KnownSpellsOffset);
+	header.ReadDword(KnownSpellsCount);
+	header.ReadDword(SpellMemorizationOffset);
+	header.ReadDword(SpellMemorizationCount);
+	header.ReadDword(MemorizedSpellsOffset);
+	header.ReadDword(MemorizedSpellsCount);
 
-	str->ReadDword(ItemSlotsOffset);
-	str->ReadDword(ItemsOffset);
-	str->ReadDword(ItemsCount);
-	str->ReadDword(EffectsOffset);
-	str->ReadDword(EffectsCount);
+	header.ReadDword(ItemSlotsOffset);
+	header.ReadDword(ItemsOffset);
+	header.ReadDword(ItemsCount);
+	header.ReadDword(EffectsOffset);
+	header.ReadDword(EffectsCount);
 
-	ReadDialog(act);
+	ReadDialog(act, header);
 }
 
 int CREImporter::GetStoredFileSize(const Actor *actor)
@@ -23,6 +23,7 @@
 
 #include "ActorMgr.h"
 #include "Spellbook.h"
+#include "Streams/BinaryView.h"
 
 namespace GemRB {
 
@@ -83,19 +84,19 @@ private:
 	void ReadChrHeader(Actor *actor);
 	/** skips the chr header */
 	bool SeekCreHeader(char *Signature);
-	void GetActorPST(Actor *actor);
-	ieDword GetActorGemRB(Actor *act);
-	void GetActorBG(Actor *actor);
-	void GetActorIWD1(Actor *actor);
-	void GetActorIWD2(Actor *actor);
+	void GetActorPST(Actor *actor, BinaryView& header);
+	ieDword GetActorGemRB(Actor *act, BinaryView& header);
+	void GetActorBG(Actor *actor, BinaryView& header);
+	void GetActorIWD1(Actor *actor, BinaryView& header);
+	void GetActorIWD2(Actor *actor, BinaryView& header);
 	ieDword GetIWD2SpellpageSize(const Actor *actor, ieIWD2SpellType type, int level) const;
 	void GetIWD2Spellpage(Actor *act, ieIWD2SpellType type, int level, int count);
 	void ReadInventory(Actor*, unsigned int);
 	void ReadSpellbook(Actor* act);
 	void ReadEffects(Actor* actor);
 	Effect* GetEffect();
-	void ReadScript(Actor *actor, int ScriptLevel);
-	void ReadDialog(Actor *actor);
+	void ReadScript(Actor *actor, int ScriptLevel, BinaryView& header);
+	void ReadDialog(Actor *actor, BinaryView& header);
 	CREKnownSpell* GetKnownSpell();
 	CRESpellMemorization* GetSpellMemorization(Actor *act);
 	CREMemorizedSpell* GetMemorizedSpell();
@@ -10501,7 +10501,7 @@ static PyObject* GemRB_LeaveParty(PyObject * /*self*/, PyObject* args)
 		}
 		if(actor->GetBase(IE_HITPOINTS) > 0) {
 			actor->Stop();
-			actor->AddAction( GenerateAction("Dialogue([PC])") );
+			actor->AddAction(MakeAction(ActionID::Dialogue).EA(EA_PC));
 		}
 	}
 	game->LeaveParty (actor);
@@ -26,6 +26,7 @@
 #include "ie_types.h"
 
 #include "Item.h"
+#include "Streams/BinaryView.h"
 
 namespace GemRB {
 
@@ -42,7 +43,7 @@ public:
 	
 private:
 	bool Import(DataStream* stream) override;
-	void GetExtHeader(const Item *s, ITMExtHeader* eh);
+	void GetExtHeader(const Item *s, ITMExtHeader* eh, BinaryView& header);
 	Effect *GetFeature(const Item *s);
 };
 
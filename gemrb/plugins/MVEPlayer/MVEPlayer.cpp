@@ -48,6 +48,8 @@ MVEPlay::MVEPlay() noexcept
 	g_palette->col[0] = ColorBlack;
 	//Set color 255 to be our subtitle color
 	g_palette->col[255] = Color(50,50,50,255);
+
+	decodeAhead = true;
 }
 
 bool MVEPlay::Import(DataStream* str)
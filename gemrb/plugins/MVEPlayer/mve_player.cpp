@@ -106,16 +106,12 @@ bool MVEPlayer::start_playback() {
 }
 
 bool MVEPlayer::next_frame() {
-	if (host->lastTime > seconds(0)) host->timer_wait(host->frame_wait);
-
 	video_rendered_frame = false;
 	while (!video_rendered_frame) {
 		if (done) return false;
 		if (!process_chunk()) return false;
 	}
 
-	if (host->lastTime == seconds(0)) host->timer_start();
-
 	return true;
 }
 
@@ -328,12 +324,7 @@ void MVEPlayer::segment_video_data(unsigned short size) {
 }
 
 void MVEPlayer::segment_video_play() {
-	if (host->video_frameskip) {
-		host->video_frameskip--;
-		host->video_skippedframes++;
-	} else {
-		host->showFrame( (guint8 *) video_data->back_buf1, video_data->width, video_data->height);
-	}
+	host->showFrame( (guint8 *) video_data->back_buf1, video_data->width, video_data->height);
 
 	video_rendered_frame = true;
 }
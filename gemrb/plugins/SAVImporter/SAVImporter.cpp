@@ -102,23 +102,31 @@ int SAVImporter::AddToSaveGame(DataStream *str, DataStream *uncompressed)
 {
 	size_t fnlen = strlen(uncompressed->filename)+1;
 	strpos_t declen = uncompressed->Size();
-	str->WriteScalar<size_t, ieDword>(fnlen);
-	str->Write( uncompressed->filename, fnlen);
-	str->WriteScalar<strpos_t, ieDword>(declen);
+	if (str->WriteScalar<size_t, ieDword>(fnlen) == DataStream::Error ||
+		str->Write(uncompressed->filename, fnlen) == DataStream::Error ||
+		str->WriteScalar<strpos_t, ieDword>(declen) == DataStream::Error) {
+		return GEM_ERROR;
+	}
 	//baaah, we dump output right in the stream, we get the compressed length
 	//only after the compressed data was written
 	ieDword complen = 0xcdcdcdcd; //placeholder
 	strpos_t Pos = str->GetPos(); //storing the stream position
-	str->WriteDword(complen);
+	if (str->WriteDword(complen) == DataStream::Error) {
+		return GEM_ERROR;
+	}
 
 	PluginHolder<Compressor> comp = MakePluginHolder<Compressor>(PLUGIN_COMPRESSION_ZLIB);
-	comp->Compress( str, uncompressed );
+	if (comp->Compress(str, uncompressed) != GEM_OK) {
+		return GEM_ERROR;
+	}
 
 	//writing compressed length (calculated)
 	strpos_t Pos2 = str->GetPos();
 	complen = ieDword(Pos2 - Pos - sizeof(ieDword)); //calculating the compressed stream size
 	str->Seek(Pos, GEM_STREAM_START); //going back to the placeholder
-	str->WriteDword(complen);       //updating size
+	if (str->WriteDword(complen) == DataStream::Error) { //updating size
+		return GEM_ERROR;
+	}
 	str->Seek(Pos2, GEM_STREAM_START);//resuming work
 	return GEM_OK;
 }
@@ -130,8 +138,10 @@ int SAVImporter::AddToSaveGameCompressed(DataStream *str, DataStream *compressed
 	BufferT::size_type remaining = compressed->Size();
 	while (remaining > 0) {
 		auto copySize = std::min(buffer.size(), remaining);
-		compressed->Read(buffer.data(), copySize);
-		str->Write(buffer.data(), copySize);
+		if (compressed->Read(buffer.data(), copySize) == DataStream::Error ||
+			str->Write(buffer.data(), copySize) == DataStream::Error) {
+			return GEM_ERROR;
+		}
 		remaining -= copySize;
 	}
 
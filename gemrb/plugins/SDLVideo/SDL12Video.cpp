@@ -454,6 +454,22 @@ void SDL12VideoDriver::DrawSDLPoints(const std::vector<SDL_Point>& points, const
 	}
 }
 
+void SDL12VideoDriver::DrawPointsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	if (flags & BlitFlags::BLENDED) {
+		DrawPointsSurface<SHADER::BLEND>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	} else if (flags & BlitFlags::MULTIPLY) {
+		DrawPointsSurface<SHADER::TINT>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	} else {
+		DrawPointsSurface<SHADER::NONE>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	}
+}
+
+void SDL12VideoDriver::DrawSDLPoints(const std::vector<SDL_Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	DrawPointsImp(points, colors, flags);
+}
+
 void SDL12VideoDriver::DrawPolygonImp(const Gem_Polygon* poly, const Point& origin, const Color& color, bool fill, BlitFlags flags)
 {
 	if (flags&BlitFlags::BLENDED && color.a < 0xff) {
@@ -487,6 +503,17 @@ void SDL12VideoDriver::DrawLinesImp(const std::vector<Point>& points, const Colo
 	}
 }
 
+void SDL12VideoDriver::DrawLineSegmentsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	if (flags & BlitFlags::BLENDED) {
+		DrawLineSegmentsSurface<SHADER::BLEND>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	} else if (flags & BlitFlags::MULTIPLY) {
+		DrawLineSegmentsSurface<SHADER::TINT>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	} else {
+		DrawLineSegmentsSurface<SHADER::NONE>(CurrentRenderBuffer(), points, colors, CurrentRenderClip());
+	}
+}
+
 /** This function Draws the Border of a Rectangle as described by the Region parameter. The Color used to draw the rectangle is passes via the Color parameter. */
 void SDL12VideoDriver::DrawRectImp(const Region& rgn, const Color& color, bool fill, BlitFlags flags)
 {
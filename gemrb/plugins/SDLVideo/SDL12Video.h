@@ -55,6 +55,8 @@ public:
 
 	void BlitVideoBuffer(const VideoBufferPtr& buf, const Point& p, BlitFlags flags,
 						 Color tint = Color()) override;
+	// the software blenders don't compose the destination alpha
+	bool BlendsIntoAlphaBuffers() const override { return false; }
 
 private:
 	VideoBuffer* NewVideoBuffer(const Region& rgn, BufferFormat fmt) override;
@@ -80,14 +82,17 @@ private:
 	void BlitWithPipeline(SDLPixelIterator& src, SDLPixelIterator& dst, IAlphaIterator* maskit, BlitFlags flags, Color tint);
 
 	void DrawSDLPoints(const std::vector<SDL_Point>& points, const SDL_Color& color, BlitFlags flags) override;
+	void DrawSDLPoints(const std::vector<SDL_Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 
 	void DrawLineImp(const Point& p1, const Point& p2, const Color& color, BlitFlags flags) override;
 	void DrawLinesImp(const std::vector<Point>& points, const Color& color, BlitFlags flags) override;
+	void DrawLineSegmentsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 
 	void DrawRectImp(const Region& rgn, const Color& color, bool fill, BlitFlags flags) override;
 
 	void DrawPointImp(const Point& p, const Color& color, BlitFlags flags) override;
 	void DrawPointsImp(const std::vector<Point>& points, const Color& color, BlitFlags flags) override;
+	void DrawPointsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 
 	void DrawPolygonImp(const Gem_Polygon* poly, const Point& origin, const Color& color, bool fill, BlitFlags flags) override;
 };
@@ -225,6 +225,7 @@ void SDL20VideoDriver::SwapBuffers(VideoBuffers& buffers)
 	blitRGBAShader->SetUniformValue("u_stencil", 1, 0);
 	blitRGBAShader->SetUniformValue("u_dither", 1, 0);
 	blitRGBAShader->SetUniformValue("u_rgba", 1, 1);
+	shaderStateValid = false;
 #endif
 	
 	SDL_SetRenderTarget(renderer, NULL);
@@ -265,19 +266,32 @@ int SDL20VideoDriver::UpdateRenderTarget(const Color* color, BlitFlags flags)
 	SDL_Texture* target = CurrentRenderBuffer();
 
 	assert(target);
-	int ret = SDL_SetRenderTarget(renderer, target);
-	if (ret != 0) {
-		Log(ERROR, "SDLVideo", "{}", SDL_GetError());
-		return ret;
+	// changing the target flushes the batch, so only do it if it is actually different
+	// we ask SDL instead of remembering it, since the buffers set themselves as targets too
+	if (SDL_GetRenderTarget(renderer) != target) {
+		int ret = SDL_SetRenderTarget(renderer, target);
+		if (ret != 0) {
+			Log(ERROR, "SDLVideo", "{}", SDL_GetError());
+			return ret;
+		}
 	}
 
+	// a disabled clip reads back as an empty rect, so only trust non empty ones
+	SDL_Rect clip;
+	SDL_RenderGetClipRect(renderer, &clip);
+	bool clipped = !SDL_RectEmpty(&clip);
 	if (screenClip.size == screenSize)
 	{
 		// Some SDL backends complain on having a clip rect of the entire renderer size
 		// I'm not sure if it is an SDL bug; possibly its just 0 based so it is out of bounds?
-		SDL_RenderSetClipRect(renderer, NULL);
+		if (clipped) {
+			SDL_RenderSetClipRect(renderer, NULL);
+		}
 	} else {
-		SDL_RenderSetClipRect(renderer, reinterpret_cast<SDL_Rect*>(&screenClip));
+		const SDL_Rect& wanted = reinterpret_cast<const SDL_Rect&>(screenClip);
+		if (!clipped || SDL_RectEmpty(&wanted) || !SDL_RectEquals(&clip, &wanted)) {
+			SDL_RenderSetClipRect(renderer, &wanted);
+		}
 	}
 
 	if (color) {
@@ -379,50 +393,78 @@ void SDL20VideoDriver::BlitVideoBuffer(const VideoBufferPtr& buf, const Point& p
 	BlitSpriteNativeClipped(tex, srect, drect, flags, reinterpret_cast<const SDL_Color*>(&tint));
 }
 
-int SDL20VideoDriver::RenderCopyShaded(SDL_Texture* texture, const SDL_Rect* srcrect,
-									   const SDL_Rect* dstrect, BlitFlags flags, const SDL_Color* tint)
-{
 #if USE_OPENGL_BACKEND
+void SDL20VideoDriver::UpdateShaderState(const ShaderState& state)
+{
+	// as long as nothing changes, SDL is free to batch our blits
+	if (shaderStateValid && state == shaderState) {
+		return;
+	}
+
 #if SDL_VERSION_ATLEAST(2, 0, 10)
 	SDL_RenderFlush(renderer);
+#endif
+	blitRGBAShader->Use();
+
+	if (!shaderStateValid) {
+		blitRGBAShader->SetUniformValue("s_sprite", 1, 0);
+		blitRGBAShader->SetUniformValue("s_stencil", 1, 1);
+	}
+	if (!shaderStateValid || state.rgba != shaderState.rgba) {
+		blitRGBAShader->SetUniformValue("u_rgba", 1, state.rgba);
+	}
+	if (!shaderStateValid || state.greyMode != shaderState.greyMode) {
+		blitRGBAShader->SetUniformValue("u_greyMode", 1, state.greyMode);
+	}
+	if (!shaderStateValid || state.channel != shaderState.channel) {
+		blitRGBAShader->SetUniformValue("u_channel", 1, state.channel);
+	}
+	if (!shaderStateValid || state.stencil != shaderState.stencil) {
+		blitRGBAShader->SetUniformValue("u_stencil", 1, state.stencil);
+	}
+
+	shaderState = state;
+	shaderStateValid = true;
+}
 #endif
 
+int SDL20VideoDriver::RenderCopyShaded(SDL_Texture* texture, const SDL_Rect* srcrect,
+									   const SDL_Rect* dstrect, BlitFlags flags, const SDL_Color* tint)
+{
+#if USE_OPENGL_BACKEND
+	ShaderState state;
+
 	uint32_t format = 0;
 	SDL_QueryTexture(texture, &format, nullptr, nullptr, nullptr);
-	blitRGBAShader->Use();
-	
-	blitRGBAShader->SetUniformValue("s_sprite", 1, 0);
-	blitRGBAShader->SetUniformValue("s_stencil", 1, 1);
-	
-	bool isRGBA = SDL_ISPIXELFORMAT_ALPHA(format);
-	blitRGBAShader->SetUniformValue("u_rgba", 1, isRGBA ? 1 : 0);
+	state.rgba = SDL_ISPIXELFORMAT_ALPHA(format) ? 1 : 0;
 
-	GLint greyMode = 0;
+	state.greyMode = 0;
 	if (flags & BlitFlags::GREY) {
-		greyMode = 1;
+		state.greyMode = 1;
 	} else if (flags & BlitFlags::SEPIA) {
-		greyMode = 2;
+		state.greyMode = 2;
 	}
 
-	blitRGBAShader->SetUniformValue("u_greyMode", 1, greyMode);
-
-	GLint channel = 3;
+	state.channel = 3;
 	if (flags & BlitFlags::STENCIL_RED) {
-		channel = 0;
+		state.channel = 0;
 	} else if (flags & BlitFlags::STENCIL_GREEN) {
-		channel = 1;
+		state.channel = 1;
 	} else if (flags & BlitFlags::STENCIL_BLUE) {
-		channel = 2;
+		state.channel = 2;
 	}
 
-	blitRGBAShader->SetUniformValue("u_channel", 1, channel);
-
 	bool doStencil = flags & BLIT_STENCIL_MASK;
-	blitRGBAShader->SetUniformValue("u_stencil", 1, doStencil ? 1 : 0);
+	state.stencil = doStencil ? 1 : 0;
+
+	UpdateShaderState(state);
 
 	if (doStencil) {
 		assert(stencilBuffer && dstrect);
 
+		// the batch was flushed after the last stencilled blit or by the state change
+		blitRGBAShader->Use();
+
 		bool doDither = flags & BlitFlags::STENCIL_DITHER;
 		blitRGBAShader->SetUniformValue("u_dither", 1, doDither ? 1 : 0);
 
@@ -464,14 +506,8 @@ int SDL20VideoDriver::RenderCopyShaded(SDL_Texture* texture, const SDL_Rect* src
 		};
 
 		blitRGBAShader->SetUniformMatrixValue("u_stencilMat", 3, 1, reinterpret_cast<GLfloat*>(&mat));
-		
-		// Ask OpenGL about the texture handle (that lies hidden in SDL_Texture otherwise)
-		auto texture = std::static_pointer_cast<SDLTextureVideoBuffer>(stencilBuffer)->GetTexture();
-		SDL_GL_BindTexture(texture, nullptr, nullptr);
-		GLuint stencilTextureID;
-		glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&stencilTextureID));
-		SDL_GL_UnbindTexture(texture);
 
+		GLuint stencilTextureID = std::static_pointer_cast<SDLTextureVideoBuffer>(stencilBuffer)->GetGLTexture();
 		glActiveTexture(GL_TEXTURE1);
 		glBindTexture(GL_TEXTURE_2D, stencilTextureID);
 	}
@@ -524,6 +560,35 @@ void SDL20VideoDriver::DrawSDLPoints(const std::vector<SDL_Point>& points, const
 	SDL_RenderDrawPoints(renderer, &points[0], int(points.size()));
 }
 
+void SDL20VideoDriver::DrawPointsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	DrawSDLPoints(reinterpret_cast<const std::vector<SDL_Point>&>(points), colors, flags);
+}
+
+void SDL20VideoDriver::DrawSDLPoints(const std::vector<SDL_Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	if (points.empty()) {
+		return;
+	}
+
+	// target, clip and blend mode are set once for the whole batch
+	// after that each run of equally colored points is a single submission
+	UpdateRenderTarget(&colors[0], flags);
+	size_t runStart = 0;
+	for (size_t i = 1; i <= points.size(); ++i) {
+		if (i < points.size() && colors[i] == colors[runStart]) {
+			continue;
+		}
+
+		if (runStart) {
+			const Color& c = colors[runStart];
+			SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+		}
+		SDL_RenderDrawPoints(renderer, &points[runStart], int(i - runStart));
+		runStart = i;
+	}
+}
+
 void SDL20VideoDriver::DrawPointImp(const Point& p, const Color& color, BlitFlags flags)
 {
 	UpdateRenderTarget(&color, flags);
@@ -547,6 +612,24 @@ void SDL20VideoDriver::DrawLineImp(const Point& p1, const Point& p2, const Color
 	SDL_RenderDrawLine(renderer, p1.x, p1.y, p2.x, p2.y);
 }
 
+void SDL20VideoDriver::DrawLineSegmentsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags)
+{
+	if (colors.empty()) {
+		return;
+	}
+
+	UpdateRenderTarget(&colors[0], flags);
+	for (size_t i = 0; i < colors.size(); ++i) {
+		if (i && colors[i] != colors[i - 1]) {
+			const Color& c = colors[i];
+			SDL_SetRenderDrawColor(renderer, c.r, c.g, c.b, c.a);
+		}
+		const Point& p1 = points[2 * i];
+		const Point& p2 = points[2 * i + 1];
+		SDL_RenderDrawLine(renderer, p1.x, p1.y, p2.x, p2.y);
+	}
+}
+
 void SDL20VideoDriver::DrawRectImp(const Region& rgn, const Color& color, bool fill, BlitFlags flags)
 {
 	UpdateRenderTarget(&color, flags);
@@ -562,16 +645,13 @@ void SDL20VideoDriver::DrawPolygonImp(const Gem_Polygon* poly, const Point& orig
 	if (fill) {
 		UpdateRenderTarget(&color, flags);
 
-		for (const auto& lineSegments : poly->rasterData)
-		{
-			for (const auto& segment : lineSegments) {
-				// SDL_RenderDrawLines actually is for drawing polygons so it is, ironically, not what we want
-				// when drawing the "rasterized" data. doing so would work ok most of the time, but other times
-				// the reconnection of the last to first point (done by SDL) will be visible
-				Point p1(segment.first + origin);
-				Point p2(segment.second + origin);
-				SDL_RenderDrawLine(renderer, p1.x, p1.y, p2.x, p2.y);
-			}
+		for (const auto& segment : poly->GetRasterData()) {
+			// SDL_RenderDrawLines actually is for drawing polygons so it is, ironically, not what we want
+			// when drawing the "rasterized" data. doing so would work ok most of the time, but other times
+			// the reconnection of the last to first point (done by SDL) will be visible
+			Point p1(segment.first + origin);
+			Point p2(segment.second + origin);
+			SDL_RenderDrawLine(renderer, p1.x, p1.y, p2.x, p2.y);
 		}
 	} else {
 		std::vector<SDL_Point> points(poly->Count() + 1);
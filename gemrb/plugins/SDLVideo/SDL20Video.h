@@ -76,6 +76,11 @@ class SDLTextureVideoBuffer : public VideoBuffer {
 	// this is also used for rendering stencils
 	SDL_Surface* conversionBuffer = nullptr;
 
+#if USE_OPENGL_BACKEND
+	// the GL name of the texture, asking SDL for it stalls the pipeline so we only do it once
+	mutable GLuint glTexture = 0;
+#endif
+
 private:
 	static Region TextureRegion(SDL_Texture* tex, const Point& p) {
 		int w, h;
@@ -206,6 +211,18 @@ public:
 	{
 		return texture;
 	}
+
+#if USE_OPENGL_BACKEND
+	GLuint GetGLTexture() const
+	{
+		if (glTexture == 0) {
+			SDL_GL_BindTexture(texture, nullptr, nullptr);
+			glGetIntegerv(GL_TEXTURE_BINDING_2D, reinterpret_cast<GLint*>(&glTexture));
+			SDL_GL_UnbindTexture(texture);
+		}
+		return glTexture;
+	}
+#endif
 };
 
 class SDL20VideoDriver : public SDLVideoDriver {
@@ -219,6 +236,23 @@ private:
 	SDL_GameController* gameController = nullptr;
 
 	GLSLProgram* blitRGBAShader = nullptr;
+#if USE_OPENGL_BACKEND
+	// what blitRGBAShader was last set up with, changing any of it requires flushing the batch
+	// the rest of the stencil setup isn't tracked, since stencilled blits are never batched
+	struct ShaderState {
+		GLint rgba = 0;
+		GLint greyMode = 0;
+		GLint channel = 0;
+		GLint stencil = 0;
+
+		bool operator==(const ShaderState& other) const {
+			return rgba == other.rgba && greyMode == other.greyMode
+				&& channel == other.channel && stencil == other.stencil;
+		}
+	};
+	ShaderState shaderState;
+	bool shaderStateValid = false;
+#endif
 public:
 	SDL20VideoDriver() noexcept;
 	~SDL20VideoDriver() noexcept override;
@@ -255,17 +289,23 @@ private:
 
 	void BeginCustomRendering(SDL_Texture*);
 	int UpdateRenderTarget(const Color* color = NULL, BlitFlags flags = BlitFlags::NONE);
+#if USE_OPENGL_BACKEND
+	void UpdateShaderState(const ShaderState&);
+#endif
 
 	void DrawSDLPoints(const std::vector<SDL_Point>& points, const SDL_Color& color, BlitFlags flags = BlitFlags::NONE) override;
+	void DrawSDLPoints(const std::vector<SDL_Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 	void DrawSDLLines(const std::vector<SDL_Point>& points, const SDL_Color& color, BlitFlags flags = BlitFlags::NONE);
 
 	void DrawLineImp(const Point& p1, const Point& p2, const Color& color, BlitFlags flags) override;
 	void DrawLinesImp(const std::vector<Point>& points, const Color& color, BlitFlags flags) override;
+	void DrawLineSegmentsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 
 	void DrawRectImp(const Region& rgn, const Color& color, bool fill, BlitFlags flags) override;
 
 	void DrawPointImp(const Point& p, const Color& color, BlitFlags flags) override;
 	void DrawPointsImp(const std::vector<Point>& points, const Color& color, BlitFlags flags) override;
+	void DrawPointsImp(const std::vector<Point>& points, const std::vector<Color>& colors, BlitFlags flags) override;
 
 	void DrawPolygonImp(const Gem_Polygon* poly, const Point& origin, const Color& color, bool fill, BlitFlags flags) override;
 
@@ -85,6 +85,75 @@ void DrawPointSurface(SDL_Surface* dst, Point p, const Region& clip, const Color
 	}
 }
 
+// shades a single pixel of a locked surface, dst must point into the surface pixels
+template<SHADER SHADE = SHADER::NONE>
+inline void ShadeSurfacePixel(SDL_Surface* surface, unsigned char* dst, const Color& srcc)
+{
+	Color dstc;
+	switch (surface->format->BytesPerPixel) {
+		case 1:
+			if (SHADE != SHADER::NONE) {
+				SDL_GetRGB( *dst, surface->format, &dstc.r, &dstc.g, &dstc.b );
+				if (SHADE == SHADER::TINT) {
+					ShaderTint(srcc, dstc);
+				} else {
+					ShaderBlend<false>(srcc, dstc);
+				}
+				*dst = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
+			} else {
+				*dst = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
+			}
+			break;
+		case 2:
+			if (SHADE != SHADER::NONE) {
+				SDL_GetRGB( *reinterpret_cast<Uint16*>(dst), surface->format, &dstc.r, &dstc.g, &dstc.b );
+				if (SHADE == SHADER::TINT) {
+					ShaderTint(srcc, dstc);
+				} else {
+					ShaderBlend<false>(srcc, dstc);
+				}
+				*reinterpret_cast<Uint16*>(dst) = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
+			} else {
+				*reinterpret_cast<Uint16*>(dst) = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
+			}
+			break;
+		case 3:
+		{
+			// FIXME: implement alpha blending for this... or nix it
+			// is this even used?
+			/*
+			Uint32 val = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+			pixel[0] = val & 0xff;
+			pixel[1] = (val >> 8) & 0xff;
+			pixel[2] = (val >> 16) & 0xff;
+#else
+			pixel[2] = val & 0xff;
+			pixel[1] = (val >> 8) & 0xff;
+			pixel[0] = (val >> 16) & 0xff;
+#endif
+			*/
+		}
+			break;
+		case 4:
+			if (SHADE != SHADER::NONE) {
+				SDL_GetRGB( *reinterpret_cast<Uint32*>(dst), surface->format, &dstc.r, &dstc.g, &dstc.b );
+				if (SHADE == SHADER::TINT) {
+					ShaderTint(srcc, dstc);
+				} else {
+					ShaderBlend<false>(srcc, dstc);
+				}
+				*reinterpret_cast<Uint32*>(dst) = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
+			} else {
+				*reinterpret_cast<Uint32*>(dst) = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
+			}
+			break;
+		default:
+			ERROR_UNKNOWN_BPP;
+			break;
+	}
+}
+
 template<SHADER SHADE = SHADER::NONE>
 void DrawPointsSurface(SDL_Surface* surface, const std::vector<Point>& points, const Region& clip, const Color& srcc)
 {
@@ -99,70 +168,27 @@ void DrawPointsSurface(SDL_Surface* surface, const std::vector<Point>& points, c
 
 		unsigned char* start = static_cast<unsigned char*>(surface->pixels);
 		unsigned char* dst = start + ((p.y * surface->pitch) + (p.x * fmt->BytesPerPixel));
+		ShadeSurfacePixel<SHADE>(surface, dst, srcc);
+	}
 
-		Color dstc;
-		switch (fmt->BytesPerPixel) {
-			case 1:
-				if (SHADE != SHADER::NONE) {
-					SDL_GetRGB( *dst, surface->format, &dstc.r, &dstc.g, &dstc.b );
-					if (SHADE == SHADER::TINT) {
-						ShaderTint(srcc, dstc);
-					} else {
-						ShaderBlend<false>(srcc, dstc);
-					}
-					*dst = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
-				} else {
-					*dst = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
-				}
-				break;
-			case 2:
-				if (SHADE != SHADER::NONE) {
-					SDL_GetRGB( *reinterpret_cast<Uint16*>(dst), surface->format, &dstc.r, &dstc.g, &dstc.b );
-					if (SHADE == SHADER::TINT) {
-						ShaderTint(srcc, dstc);
-					} else {
-						ShaderBlend<false>(srcc, dstc);
-					}
-					*reinterpret_cast<Uint16*>(dst) = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
-				} else {
-					*reinterpret_cast<Uint16*>(dst) = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
-				}
-				break;
-			case 3:
-			{
-				// FIXME: implement alpha blending for this... or nix it
-				// is this even used?
-				/*
-				Uint32 val = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
-	#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-				pixel[0] = val & 0xff;
-				pixel[1] = (val >> 8) & 0xff;
-				pixel[2] = (val >> 16) & 0xff;
-	#else
-				pixel[2] = val & 0xff;
-				pixel[1] = (val >> 8) & 0xff;
-				pixel[0] = (val >> 16) & 0xff;
-	#endif
-				*/
-			}
-				break;
-			case 4:
-				if (SHADE != SHADER::NONE) {
-					SDL_GetRGB( *reinterpret_cast<Uint32*>(dst), surface->format, &dstc.r, &dstc.g, &dstc.b );
-					if (SHADE == SHADER::TINT) {
-						ShaderTint(srcc, dstc);
-					} else {
-						ShaderBlend<false>(srcc, dstc);
-					}
-					*reinterpret_cast<Uint32*>(dst) = SDL_MapRGB(surface->format, dstc.r, dstc.g, dstc.b);
-				} else {
-					*reinterpret_cast<Uint32*>(dst) = SDL_MapRGB(surface->format, srcc.r, srcc.g, srcc.b);
-				}
-				break;
-			default:
-				ERROR_UNKNOWN_BPP;
-				break;
-		}
+	SDL_UnlockSurface( surface );
+}
+
+// batched version with a color per point, the whole batch shares a single lock
+template<SHADER SHADE = SHADER::NONE>
+void DrawPointsSurface(SDL_Surface* surface, const std::vector<Point>& points, const std::vector<Color>& colors, const Region& clip)
+{
+	assert(points.size() == colors.size());
+	const SDL_PixelFormat* fmt = surface->format;
+	SDL_LockSurface( surface );
+
+	unsigned char* start = static_cast<unsigned char*>(surface->pixels);
+	for (size_t i = 0; i < points.size(); ++i) {
+		const Point& p = points[i];
+		if (!clip.PointInside(p) || PointClipped(surface, p)) continue;
+
+		unsigned char* dst = start + ((p.y * surface->pitch) + (p.x * fmt->BytesPerPixel));
+		ShadeSurfacePixel<SHADE>(surface, dst, colors[i]);
 	}
 
 	SDL_UnlockSurface( surface );
@@ -260,15 +286,9 @@ inline void DrawVLineSurface(SDL_Surface* dst, Point p, int y2, const Region& cl
 	}
 }
 
-template<SHADER SHADE = SHADER::NONE>
-void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end, const Region& clip, const Color& color)
+// appends the clipped points of a line to points, the caller decides how to draw them
+inline void RasterizeLine(const Point& start, const Point& end, const Region& clip, std::vector<Point>& points)
 {
-	if (start.y == end.y) return DrawHLineSurface<SHADE>(surface, start, end.x, clip, color);
-	if (start.x == end.x) return DrawVLineSurface<SHADE>(surface, start, end.y, clip, color);
-
-	assert(clip.x >= 0 && clip.w <= surface->w);
-	assert(clip.y >= 0 && clip.h <= surface->h);
-
 	Point p1 = start;
 	Point p2 = end;
 
@@ -291,14 +311,7 @@ void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end,
 	// however, since we are only aproximating a straight line (because pixels)
 	// and sqrts are expensive and mallocs larger mallocs arent more expensive than smaller ones
 	// we will just overestimate by reserving shortLen + longLen Points
-	// we continually recycle this vector
-	// this prevents constant allocation/deallocation
-	// while drawing. Yes, its permanantly used memory, but we do
-	// enough drawing that this is not a problem (its a tiny amount anyway)
-	// Point is trivial and clear() should be constant
-	static std::vector<Point> s_points;
-	s_points.clear();
-	s_points.reserve(std::abs(longLen) + std::abs(shortLen));
+	points.reserve(points.size() + std::abs(longLen) + std::abs(shortLen));
 	Point newp;
 
 	do { // TODO: rewrite without loop
@@ -308,7 +321,7 @@ void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end,
 				for (int j = 0x8000 + ( p1.x << 16 ); p1.y <= longLen; ++p1.y) {
 					newp = Point( j >> 16, p1.y );
 					if (clip.PointInside(newp))
-						s_points.push_back(newp);
+						points.push_back(newp);
 					j += decInc;
 				}
 				break;
@@ -317,7 +330,7 @@ void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end,
 			for (int j = 0x8000 + ( p1.x << 16 ); p1.y >= longLen; --p1.y) {
 				newp = Point( j >> 16, p1.y );
 				if (clip.PointInside(newp))
-					s_points.push_back(newp);
+					points.push_back(newp);
 				j -= decInc;
 			}
 			break;
@@ -328,7 +341,7 @@ void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end,
 			for (int j = 0x8000 + ( p1.y << 16 ); p1.x <= longLen; ++p1.x) {
 				newp = Point( p1.x, j >> 16 );
 				if (clip.PointInside(newp))
-					s_points.push_back(newp);
+					points.push_back(newp);
 				j += decInc;
 			}
 			break;
@@ -337,10 +350,29 @@ void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end,
 		for (int j = 0x8000 + ( p1.y << 16 ); p1.x >= longLen; --p1.x) {
 			newp = Point( p1.x, j >> 16 );
 			if (clip.PointInside(newp))
-				s_points.push_back(newp);
+				points.push_back(newp);
 			j -= decInc;
 		}
 	} while (false);
+}
+
+template<SHADER SHADE = SHADER::NONE>
+void DrawLineSurface(SDL_Surface* surface, const Point& start, const Point& end, const Region& clip, const Color& color)
+{
+	if (start.y == end.y) return DrawHLineSurface<SHADE>(surface, start, end.x, clip, color);
+	if (start.x == end.x) return DrawVLineSurface<SHADE>(surface, start, end.y, clip, color);
+
+	assert(clip.x >= 0 && clip.w <= surface->w);
+	assert(clip.y >= 0 && clip.h <= surface->h);
+
+	// we continually recycle this vector
+	// this prevents constant allocation/deallocation
+	// while drawing. Yes, its permanantly used memory, but we do
+	// enough drawing that this is not a problem (its a tiny amount anyway)
+	// Point is trivial and clear() should be constant
+	static std::vector<Point> s_points;
+	s_points.clear();
+	RasterizeLine(start, end, clip, s_points);
 
 	DrawPointsSurface<SHADE>(surface, s_points, clip, color);
 }
@@ -356,15 +388,35 @@ void DrawLinesSurface(SDL_Surface* surface, const std::vector<Point>& points, co
 	}
 }
 
+// batched segments with a color each: everything is rasterized first, then drawn under a single lock
+template<SHADER SHADE = SHADER::NONE>
+void DrawLineSegmentsSurface(SDL_Surface* surface, const std::vector<Point>& points, const std::vector<Color>& colors, const Region& clip)
+{
+	assert(points.size() == colors.size() * 2);
+	assert(clip.x >= 0 && clip.w <= surface->w);
+	assert(clip.y >= 0 && clip.h <= surface->h);
+
+	// recycled like the single line buffer
+	static std::vector<Point> s_points;
+	static std::vector<Color> s_colors;
+	s_points.clear();
+	s_colors.clear();
+
+	for (size_t i = 0; i < colors.size(); ++i) {
+		size_t first = s_points.size();
+		RasterizeLine(points[2 * i], points[2 * i + 1], clip, s_points);
+		s_colors.insert(s_colors.end(), s_points.size() - first, colors[i]);
+	}
+
+	DrawPointsSurface<SHADE>(surface, s_points, s_colors, clip);
+}
+
 template<SHADER SHADE = SHADER::NONE>
 void DrawPolygonSurface(SDL_Surface* surface, const Gem_Polygon* poly, const Point& origin, const Region& clip, const Color& color, bool fill)
 {
 	if (fill) {
-		for (const auto& lineSegments : poly->rasterData)
-		{
-			for (const auto& segment : lineSegments) {
-				DrawHLineSurface<SHADE>(surface, segment.first + origin, (segment.second + origin).x, clip, color);
-			}
+		for (const auto& segment : poly->GetRasterData()) {
+			DrawHLineSurface<SHADE>(surface, segment.first + origin, (segment.second + origin).x, clip, color);
 		}
 	} else {
 		// we continually recycle this vector
@@ -374,25 +426,16 @@ void DrawPolygonSurface(SDL_Surface* surface, const Gem_Polygon* poly, const Poi
 		// Point is trivial and clear() should be constant
 		static std::vector<Point> s_points;
 		s_points.clear();
-		s_points.resize(poly->Count()*2); // resize, not reserve! (it won't shrink the capacity FYI)
-
-		const Point& p = poly->vertices[0] - poly->BBox.origin + origin;
-		s_points[0].x = p.x;
-		s_points[0].y = p.y;
-
-		size_t j = 1;
-		for (size_t i = 1; i < poly->Count(); ++i, j+=2) {
-			// this is not a typo. one point ends the previous line, the next begins the next line
-			const Point& v = poly->vertices[i] - poly->BBox.origin + origin;
-			s_points[j].x = v.x;
-			s_points[j].y = v.y;
-			s_points[j+1] = s_points[j];
+
+		// rasterize every edge first, so the whole outline is drawn under a single lock
+		Point prev = poly->vertices.back() - poly->BBox.origin + origin;
+		for (const Point& vertex : poly->vertices) {
+			Point cur = vertex - poly->BBox.origin + origin;
+			RasterizeLine(prev, cur, clip, s_points);
+			prev = cur;
 		}
-		// reconnect with start point
-		s_points[j].x = p.x;
-		s_points[j].y = p.y;
 
-		DrawLinesSurface<SHADE>(surface, s_points, clip, color);
+		DrawPointsSurface<SHADE>(surface, s_points, clip, color);
 	}
 }
 
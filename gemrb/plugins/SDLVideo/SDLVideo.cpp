@@ -283,8 +283,8 @@ Point _p(_x, _y); \
 if (_r.PointInside(_p)) { points.push_back(_p); } }
 #endif
 
-/** This functions Draws a Circle */
-void SDLVideoDriver::DrawCircleImp(const Point& c, unsigned short r, const Color& color, BlitFlags flags)
+// appends the points of a circle to the batch, so several circles can share one submission
+void SDLVideoDriver::AppendCirclePoints(std::vector<SDL_Point>& points, const Point& c, unsigned short r) const
 {
 	//Uses the Breshenham's Circle Algorithm
 	int x = r;
@@ -293,8 +293,6 @@ void SDLVideoDriver::DrawCircleImp(const Point& c, unsigned short r, const Color
 	long yc = 1;
 	long re = 0;
 
-	std::vector<SDL_Point> points;
-
 	while (x >= y) {
 		SetPixel( drawingBuffer, c.x + x, c.y + y );
 		SetPixel( drawingBuffer, c.x - x, c.y + y );
@@ -315,10 +313,34 @@ void SDLVideoDriver::DrawCircleImp(const Point& c, unsigned short r, const Color
 			xc += 2;
 		}
 	}
+}
+
+/** This functions Draws a Circle */
+void SDLVideoDriver::DrawCircleImp(const Point& c, unsigned short r, const Color& color, BlitFlags flags)
+{
+	std::vector<SDL_Point> points;
+	AppendCirclePoints(points, c, r);
 
 	DrawSDLPoints(points, reinterpret_cast<const SDL_Color&>(color), flags);
 }
 
+void SDLVideoDriver::DrawCirclesImp(const std::vector<Point>& origins, unsigned short r, const std::vector<Color>& colors, BlitFlags flags)
+{
+	// recycled between calls, particles draw many of these every frame
+	static std::vector<SDL_Point> s_points;
+	static std::vector<Color> s_colors;
+	s_points.clear();
+	s_colors.clear();
+
+	for (size_t i = 0; i < origins.size(); ++i) {
+		size_t start = s_points.size();
+		AppendCirclePoints(s_points, origins[i], r);
+		s_colors.insert(s_colors.end(), s_points.size() - start, colors[i]);
+	}
+
+	DrawSDLPoints(s_points, s_colors, flags);
+}
+
 static double ellipseradius(unsigned short xr, unsigned short yr, double angle) {
 	double one = (xr * sin(angle));
 	double two = (yr * cos(angle));
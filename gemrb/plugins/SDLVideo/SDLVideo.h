@@ -105,8 +105,11 @@ protected:
 private:
 	virtual int CreateSDLDisplay(const char* title) = 0;
 	virtual void DrawSDLPoints(const std::vector<SDL_Point>& points, const SDL_Color& color, BlitFlags flags = BlitFlags::NONE)=0;
+	virtual void DrawSDLPoints(const std::vector<SDL_Point>& points, const std::vector<Color>& colors, BlitFlags flags)=0;
 
+	void AppendCirclePoints(std::vector<SDL_Point>& points, const Point& origin, unsigned short r) const;
 	void DrawCircleImp(const Point& origin, unsigned short r, const Color& color, BlitFlags flags) override;
+	void DrawCirclesImp(const std::vector<Point>& origins, unsigned short r, const std::vector<Color>& colors, BlitFlags flags) override;
 	void DrawEllipseSegmentImp(const Point& origin, unsigned short xr, unsigned short yr, const Color& color,
 							   double anglefrom, double angleto, bool drawlines, BlitFlags flags) override;
 public:
@@ -104,51 +104,53 @@ bool SPLImporter::Open(DataStream* stream)
 
 Spell* SPLImporter::GetSpell(Spell *s, bool /*silent*/)
 {
-	str->ReadStrRef(s->SpellName);
-	str->ReadStrRef(s->SpellNameIdentified);
-	str->ReadResRef( s->CompletionSound );
-	str->ReadDword(s->Flags);
-	str->ReadWord(s->SpellType);
-	str->ReadWord(s->ExclusionSchool);
-	str->ReadWord(s->PriestType);
-	str->ReadWord(s->CastingGraphics);
+	// the fixed header is parsed from a single view instead of the stream
+	BinaryView header(str, (version == 20 ? 0x82 : 0x72) - 8);
+	header.ReadStrRef(s->SpellName);
+	header.ReadStrRef(s->SpellNameIdentified);
+	header.ReadResRef( s->CompletionSound );
+	header.ReadDword(s->Flags);
+	header.ReadWord(s->SpellType);
+	header.ReadWord(s->ExclusionSchool);
+	header.ReadWord(s->PriestType);
+	header.ReadWord(s->CastingGraphics);
 	s->CastingSound = GetCGSound(s->CastingGraphics);
-	str->Read( &s->unknown1, 1 );
-	str->ReadWord(s->PrimaryType);
-	str->Read( &s->SecondaryType, 1 );
-	str->ReadDword(s->unknown2);
-	str->ReadDword(s->unknown3);
-	str->ReadDword(s->unknown4);
-	str->ReadDword(s->SpellLevel);
-	str->ReadWord(s->unknown5);
-	str->ReadResRef( s->SpellbookIcon );
+	header.Read( &s->unknown1, 1 );
+	header.ReadWord(s->PrimaryType);
+	header.Read( &s->SecondaryType, 1 );
+	header.ReadDword(s->unknown2);
+	header.ReadDword(s->unknown3);
+	header.ReadDword(s->unknown4);
+	header.ReadDword(s->SpellLevel);
+	header.ReadWord(s->unknown5);
+	header.ReadResRef( s->SpellbookIcon );
 	//this hack is needed in ToB at least
 	if (!s->SpellbookIcon.IsEmpty() && core->HasFeature(GF_SPELLBOOKICONHACK)) {
 		s->SpellbookIcon.Format("{:.7}c", s->SpellbookIcon);
 	}
 
-	str->ReadWord(s->unknown6);
-	str->ReadDword(s->unknown7);
-	str->ReadDword(s->unknown8);
-	str->ReadDword(s->unknown9);
-	str->ReadStrRef(s->SpellDesc);
-	str->ReadStrRef(s->SpellDescIdentified);
-	str->ReadDword(s->unknown10);
-	str->ReadDword(s->unknown11);
-	str->ReadDword(s->unknown12);
-	str->ReadDword(s->ExtHeaderOffset);
+	header.ReadWord(s->unknown6);
+	header.ReadDword(s->unknown7);
+	header.ReadDword(s->unknown8);
+	header.ReadDword(s->unknown9);
+	header.ReadStrRef(s->SpellDesc);
+	header.ReadStrRef(s->SpellDescIdentified);
+	header.ReadDword(s->unknown10);
+	header.ReadDword(s->unknown11);
+	header.ReadDword(s->unknown12);
+	header.ReadDword(s->ExtHeaderOffset);
 	ieWord headerCount;
-	str->ReadWord(headerCount);
-	str->ReadDword(s->FeatureBlockOffset);
-	str->ReadWord(s->CastingFeatureOffset);
-	str->ReadWord(s->CastingFeatureCount);
+	header.ReadWord(headerCount);
+	header.ReadDword(s->FeatureBlockOffset);
+	header.ReadWord(s->CastingFeatureOffset);
+	header.ReadWord(s->CastingFeatureCount);
 
 	memset( s->unknown13, 0, 14 );
 	if (version == 20) {
 		//these fields are used in simplified duration
-		str->Read( &s->TimePerLevel, 1);
-		str->Read( &s->TimeConstant, 1 );
-		str->Read( s->unknown13, 14 );
+		header.Read( &s->TimePerLevel, 1);
+		header.Read( &s->TimeConstant, 1 );
+		header.Read( s->unknown13, 14 );
 		//moving some bits, because bg2 uses them differently
 		//the low byte is unused, so we can keep the iwd2 bits there
 		s->Flags|=(s->Flags>>8)&0xc0;
@@ -167,9 +169,11 @@ Spell* SPLImporter::GetSpell(Spell *s, bool /*silent*/)
 
 	s->ext_headers = std::vector<SPLExtHeader>(headerCount);
 
+	str->Seek(s->ExtHeaderOffset, GEM_STREAM_START);
+	BinaryView extHeaders(str, headerCount * 40);
 	for (ieWord i = 0; i < headerCount; i++) {
-		str->Seek( s->ExtHeaderOffset + i * 40, GEM_STREAM_START );
-		GetExtHeader(s, &s->ext_headers[i]);
+		extHeaders.Seek(i * 40, GEM_STREAM_START);
+		GetExtHeader(s, &s->ext_headers[i], extHeaders);
 	}
 
 	s->casting_features.reserve(s->CastingFeatureCount);
@@ -184,17 +188,17 @@ Spell* SPLImporter::GetSpell(Spell *s, bool /*silent*/)
 	return s;
 }
 
-void SPLImporter::GetExtHeader(const Spell *s, SPLExtHeader* eh)
+void SPLImporter::GetExtHeader(const Spell *s, SPLExtHeader* eh, BinaryView& header)
 {
 	ieByte tmpByte;
 
-	str->Read( &eh->SpellForm, 1 );
+	header.Read( &eh->SpellForm, 1 );
 	//this byte is used in PST
-	str->Read( &eh->Hostile, 1 );
-	str->Read( &eh->Location, 1 );
-	str->Read( &eh->unknown2, 1 );
-	str->ReadResRef(eh->memorisedIcon);
-	str->Read( &eh->Target, 1 );
+	header.Read( &eh->Hostile, 1 );
+	header.Read( &eh->Location, 1 );
+	header.Read( &eh->unknown2, 1 );
+	header.ReadResRef(eh->memorisedIcon);
+	header.Read( &eh->Target, 1 );
 
 	//this hack is to let gemrb target dead actors by some spells
 	if (eh->Target == 1) {
@@ -202,24 +206,24 @@ void SPLImporter::GetExtHeader(const Spell *s, SPLExtHeader* eh)
 			eh->Target = 3;
 		}
 	}
-	str->Read( &tmpByte,1 );
+	header.Read( &tmpByte,1 );
 	if (!tmpByte) {
 		tmpByte = 1;
 	}
 	eh->TargetNumber = tmpByte;
-	str->ReadWord(eh->Range);
-	str->ReadWord(eh->RequiredLevel);
-	str->ReadDword(eh->CastingTime);
-	str->ReadWord(eh->DiceSides);
-	str->ReadWord(eh->DiceThrown);
-	str->ReadWord(eh->DamageBonus);
-	str->ReadWord(eh->DamageType);
+	header.ReadWord(eh->Range);
+	header.ReadWord(eh->RequiredLevel);
+	header.ReadDword(eh->CastingTime);
+	header.ReadWord(eh->DiceSides);
+	header.ReadWord(eh->DiceThrown);
+	header.ReadWord(eh->DamageBonus);
+	header.ReadWord(eh->DamageType);
 	ieWord featureCount;
-	str->ReadWord(featureCount);
-	str->ReadWord(eh->FeatureOffset);
-	str->ReadWord(eh->Charges);
-	str->ReadWord(eh->ChargeDepletion);
-	str->ReadWord(eh->ProjectileAnimation);
+	header.ReadWord(featureCount);
+	header.ReadWord(eh->FeatureOffset);
+	header.ReadWord(eh->Charges);
+	header.ReadWord(eh->ChargeDepletion);
+	header.ReadWord(eh->ProjectileAnimation);
 
 	//for some odd reasons 0 and 1 are the same
 	if (eh->ProjectileAnimation) {
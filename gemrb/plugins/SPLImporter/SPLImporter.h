@@ -26,6 +26,7 @@
 #include "ie_types.h"
 
 #include "Spell.h"
+#include "Streams/BinaryView.h"
 
 namespace GemRB {
 
@@ -43,7 +44,7 @@ public:
 	bool Open(DataStream* stream) override;
 	Spell* GetSpell(Spell *spl, bool silent=false) override;
 private:
-	void GetExtHeader(const Spell *s, SPLExtHeader* eh);
+	void GetExtHeader(const Spell *s, SPLExtHeader* eh, BinaryView& header);
 	Effect *GetFeature(const Spell *s);
 };
 